@@ -12,6 +12,7 @@ else()
     message(STATUS "Multithreading is disabled.")
     add_definitions(-DNO_MULTITHREADING)
     set(OMP_MULTITHREADING OFF)
+    set(WORK_STEALING_MULTITHREADING OFF)
 endif()
 
 if(OMP_MULTITHREADING)
@@ -23,6 +24,11 @@ else()
     add_definitions(-DNO_OMP_MULTITHREADING)
 endif()
 
+if(WORK_STEALING_MULTITHREADING)
+    message(STATUS "Work-stealing multithreading is enabled.")
+    add_definitions(-DWORK_STEALING_MULTITHREADING)
+endif()
+
 if(DISABLE_TBB)
     message(STATUS "Intel Thread Building Blocks is disabled.")
     add_definitions(-DNO_TBB)
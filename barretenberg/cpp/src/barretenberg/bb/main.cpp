@@ -47,6 +47,9 @@ std::string getHomeDir()
 
 std::string CRS_PATH = getHomeDir() + "/.bb-crs";
 
+// Set by --low-memory-sumcheck, for the Honk and ClientIVC provers
+bool low_memory_sumcheck = false;
+
 const std::filesystem::path current_path = std::filesystem::current_path();
 const auto current_dir = current_path.filename().string();
 
@@ -192,6 +195,7 @@ bool proveAndVerifyHonkAcirFormat(acir_format::AcirFormat constraint_system, aci
 
     // Construct Honk proof
     Prover prover{ builder };
+    prover.low_memory_sumcheck = low_memory_sumcheck;
     auto proof = prover.construct_proof();
 
     // Verify Honk proof
@@ -352,6 +356,7 @@ void client_ivc_prove_output_all_msgpack(const std::string& bytecodePath,
     // TODO(#7371) dedupe this with the rest of the similar code
     ClientIVC ivc;
     ivc.trace_structure = TraceStructure::E2E_FULL_TEST;
+    ivc.low_memory_sumcheck = low_memory_sumcheck;
 
     // Accumulate the entire program stack into the IVC
     for (Program& program : folding_stack) {
@@ -438,6 +443,7 @@ bool foldAndVerifyProgram(const std::string& bytecodePath, const std::string& wi
 
     ClientIVC ivc;
     ivc.trace_structure = TraceStructure::SMALL_TEST;
+    ivc.low_memory_sumcheck = low_memory_sumcheck;
 
     auto program_stack = acir_format::get_acir_program_stack(
         bytecodePath, witnessPath, false); // TODO(https://github.com/AztecProtocol/barretenberg/issues/1013): this
@@ -480,6 +486,7 @@ void client_ivc_prove_output_all(const std::string& bytecodePath,
 
     ClientIVC ivc;
     ivc.trace_structure = TraceStructure::E2E_FULL_TEST;
+    ivc.low_memory_sumcheck = low_memory_sumcheck;
 
     auto program_stack = acir_format::get_acir_program_stack(
         bytecodePath, witnessPath, false); // TODO(https://github.com/AztecProtocol/barretenberg/issues/1013): this
@@ -613,6 +620,7 @@ void prove_tube(const std::string& output_path)
     using Prover = UltraProver_<UltraFlavor>;
     using Verifier = UltraVerifier_<UltraFlavor>;
     Prover tube_prover{ *builder };
+    tube_prover.low_memory_sumcheck = low_memory_sumcheck;
     auto tube_proof = tube_prover.construct_proof();
     std::string tubeProofPath = output_path + "/proof";
     write_file(tubeProofPath, to_buffer<true>(tube_proof));
@@ -1051,6 +1059,7 @@ UltraProver_<Flavor> compute_valid_prover(const std::string& bytecodePath, const
     init_bn254_crs(srs_size);
 
     Prover prover{ builder };
+    prover.low_memory_sumcheck = low_memory_sumcheck;
     return prover;
 }
 
@@ -1290,6 +1299,7 @@ void prove_honk_output_all(const std::string& bytecodePath,
 
     // Construct Honk proof
     Prover prover{ builder };
+    prover.low_memory_sumcheck = low_memory_sumcheck;
     auto proof = prover.construct_proof();
 
     // We have been given a directory, we will write the proof and verification key
@@ -1352,6 +1362,7 @@ int main(int argc, char* argv[])
         std::string vk_path = get_option(args, "-k", "./target/vk");
         std::string pk_path = get_option(args, "-r", "./target/pk");
         bool honk_recursion = flag_present(args, "-h");
+        low_memory_sumcheck = flag_present(args, "--low-memory-sumcheck");
         CRS_PATH = get_option(args, "-c", CRS_PATH);
 
         // Skip CRS initialization for any command which doesn't require the CRS.
@@ -1456,6 +1467,8 @@ int main(int argc, char* argv[])
             std::filesystem::path output_path = get_option(args, "-o", "./proofs");
             extern std::filesystem::path avm_dump_trace_path;
             avm_dump_trace_path = get_option(args, "--avm-dump-trace", "");
+            extern bool avm_low_memory_sumcheck;
+            avm_low_memory_sumcheck = flag_present(args, "--avm-low-memory-sumcheck");
             avm_prove(avm_bytecode_path, avm_calldata_path, avm_public_inputs_path, avm_hints_path, output_path);
         } else if (command == "avm_verify") {
             return avm_verify(proof_path, vk_path) ? 0 : 1;
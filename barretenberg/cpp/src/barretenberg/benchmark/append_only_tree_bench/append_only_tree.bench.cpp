@@ -40,6 +40,67 @@ template <typename TreeType> void append_only_tree_bench(State& state) noexcept
         perform_batch_insert(tree, values);
     }
 }
+template <typename TreeType> void add_values_bench(State& state) noexcept
+{
+    const size_t num_leaves = size_t(state.range(0));
+    const size_t depth = TREE_DEPTH;
+
+    std::vector<fr> values(num_leaves);
+    for (size_t i = 0; i < num_leaves; ++i) {
+        values[i] = fr(random_engine.get_random_uint256());
+    }
+    for (auto _ : state) {
+        state.PauseTiming();
+        ArrayStore store(depth, num_leaves);
+        TreeType tree = TreeType(store, depth);
+        state.ResumeTiming();
+        perform_batch_insert(tree, values);
+    }
+}
+
+template <typename TreeType> void get_hash_path_bench(State& state) noexcept
+{
+    const size_t num_leaves = size_t(state.range(0));
+    const size_t depth = TREE_DEPTH;
+
+    ArrayStore store(depth, 1024 * 1024);
+    TreeType tree = TreeType(store, depth);
+    std::vector<fr> values(num_leaves);
+    for (size_t i = 0; i < num_leaves; ++i) {
+        values[i] = fr(random_engine.get_random_uint256());
+    }
+    tree.add_values(values);
+
+    fr_hash_path path;
+    size_t index = 0;
+    for (auto _ : state) {
+        tree.get_hash_path(index, path);
+        DoNotOptimize(path);
+        index = (index + 1) % num_leaves;
+    }
+}
+template <typename TreeType> void get_hash_paths_bench(State& state) noexcept
+{
+    const size_t num_paths = size_t(state.range(0));
+    const size_t num_leaves = 1024;
+    const size_t depth = TREE_DEPTH;
+
+    ArrayStore store(depth, 1024 * 1024);
+    TreeType tree = TreeType(store, depth);
+    std::vector<fr> values(num_leaves);
+    for (size_t i = 0; i < num_leaves; ++i) {
+        values[i] = fr(random_engine.get_random_uint256());
+    }
+    tree.add_values(values);
+
+    std::vector<index_t> indices(num_paths);
+    for (auto& index : indices) {
+        index = random_engine.get_random_uint64() % num_leaves;
+    }
+    for (auto _ : state) {
+        DoNotOptimize(tree.get_hash_paths(indices));
+    }
+}
 BENCHMARK(append_only_tree_bench<Pedersen>)
     ->Unit(benchmark::kMillisecond)
     ->RangeMultiplier(2)
@@ -51,4 +112,8 @@ BENCHMARK(append_only_tree_bench<Poseidon2>)
     ->Range(2, MAX_BATCH_SIZE)
     ->Iterations(1000);
 
+BENCHMARK(add_values_bench<Poseidon2>)->Unit(benchmark::kMillisecond)->RangeMultiplier(4)->Range(64, 65536);
+BENCHMARK(get_hash_path_bench<Poseidon2>)->Unit(benchmark::kMicrosecond)->Arg(1024);
+BENCHMARK(get_hash_paths_bench<Poseidon2>)->Unit(benchmark::kMicrosecond)->RangeMultiplier(4)->Range(16, 1024);
+
 BENCHMARK_MAIN();
\ No newline at end of file
@@ -37,8 +37,11 @@ class ClientIVCBench : public benchmark::Fixture {
      *
      * @param ivc
      * @param num_function_circuits
+     * @param batch_size Number of circuits folded per round (see ClientIVC::precompute_folding_verification_keys)
      */
-    static auto precompute_verification_keys(ClientIVC& ivc, const size_t num_function_circuits)
+    static auto precompute_verification_keys(ClientIVC& ivc,
+                                             const size_t num_function_circuits,
+                                             const size_t batch_size = 1)
     {
         // Populate the set of mock function and kernel circuits to be accumulated in the IVC
         std::vector<Builder> circuits;
@@ -57,7 +60,7 @@ class ClientIVCBench : public benchmark::Fixture {
         }
 
         // Compute and return the verfication keys corresponding to this set of circuits
-        return ivc.precompute_folding_verification_keys(circuits);
+        return ivc.precompute_folding_verification_keys(circuits, batch_size);
     }
 
     /**
@@ -142,6 +145,92 @@ class ClientIVCBench : public benchmark::Fixture {
         }
         ivc.accumulate(kernel_circuit, precomputed_vks.back());
     }
+
+    /**
+     * @brief Accumulate the same sequence of function and kernel circuits as perform_ivc_accumulation_rounds via
+     * accumulate_async, constructing each circuit while its predecessor is folded in the background
+     * @details Each circuit is built on its own op queue (the previous one being prepended prior to accumulation) so
+     * that its construction is independent of the IVC state touched by the in-flight fold.
+     *
+     * @param NUM_CIRCUITS Number of function circuits to accumulate
+     */
+    static void perform_async_ivc_accumulation_rounds(size_t NUM_CIRCUITS, ClientIVC& ivc, auto& precomputed_vks)
+    {
+        size_t TOTAL_NUM_CIRCUITS = NUM_CIRCUITS * 2 - 1;     // need one less kernel than number of function circuits
+        ASSERT(precomputed_vks.size() == TOTAL_NUM_CIRCUITS); // ensure presence of a precomputed VK for each circuit
+
+        const size_t size_hint = 1 << 17; // Size hint for reserving wires/selector vector memory in builders
+        for (size_t circuit_idx = 0; circuit_idx < TOTAL_NUM_CIRCUITS; ++circuit_idx) {
+            // Two function circuits, then alternating kernel and function circuits ending with a kernel
+            const bool is_kernel = circuit_idx >= 2 && circuit_idx % 2 == 0;
+            Builder circuit{ size_hint };
+            {
+                BB_OP_COUNT_TIME_NAME("construct_circuits");
+                if (is_kernel) {
+                    GoblinMockCircuits::construct_mock_folding_kernel(circuit);
+                } else {
+                    GoblinMockCircuits::construct_mock_function_circuit(circuit);
+                }
+            }
+
+            // Prepend queue, accumulate in the background then retrieve the queue
+            circuit.op_queue->prepend_previous_queue(*ivc.goblin.op_queue);
+            ivc.accumulate_async(circuit, precomputed_vks[circuit_idx]);
+            std::swap(*ivc.goblin.op_queue, *circuit.op_queue);
+        }
+        ivc.wait_for_accumulation();
+    }
+
+    /**
+     * @brief Accumulate the same sequence of function and kernel circuits as perform_ivc_accumulation_rounds, but fold
+     * batch_size of them into the accumulator per round
+     * @details Each round constructs a single (larger) fold proof, which is verified recursively in the first circuit
+     * of the following round. Increasing the batch size therefore reduces the number of folds and of recursive folding
+     * verifiers at the cost of a more expensive combiner and fold verifier.
+     *
+     * @param NUM_CIRCUITS Number of function circuits to accumulate
+     * @param batch_size Number of circuits folded per round, at most ClientIVC::MAX_BATCH_SIZE
+     */
+    static void perform_batched_ivc_accumulation_rounds(size_t NUM_CIRCUITS,
+                                                        size_t batch_size,
+                                                        ClientIVC& ivc,
+                                                        auto& precomputed_vks)
+    {
+        size_t TOTAL_NUM_CIRCUITS = NUM_CIRCUITS * 2 - 1;     // need one less kernel than number of function circuits
+        ASSERT(precomputed_vks.size() == TOTAL_NUM_CIRCUITS); // ensure presence of a precomputed VK for each circuit
+
+        // Initialize the IVC with a function circuit
+        {
+            Builder function_circuit{ ivc.goblin.op_queue };
+            {
+                BB_OP_COUNT_TIME_NAME("construct_circuits");
+                GoblinMockCircuits::construct_mock_function_circuit(function_circuit);
+            }
+            ivc.accumulate(function_circuit, precomputed_vks[0]);
+        }
+
+        // Accumulate the remaining circuits, which alternate {function, kernel}, in batches
+        for (size_t start = 1; start < TOTAL_NUM_CIRCUITS; start += batch_size) {
+            const size_t end = std::min(start + batch_size, TOTAL_NUM_CIRCUITS);
+            std::vector<Builder> circuits;
+            {
+                BB_OP_COUNT_TIME_NAME("construct_circuits");
+                for (size_t circuit_idx = start; circuit_idx < end; ++circuit_idx) {
+                    Builder circuit{ ivc.goblin.op_queue };
+                    if (circuit_idx % 2 == 1) {
+                        GoblinMockCircuits::construct_mock_function_circuit(circuit);
+                    } else {
+                        GoblinMockCircuits::construct_mock_folding_kernel(circuit);
+                    }
+                    circuits.emplace_back(std::move(circuit));
+                }
+            }
+            std::vector<std::shared_ptr<ClientIVC::VerificationKey>> vks(
+                precomputed_vks.begin() + static_cast<std::ptrdiff_t>(start),
+                precomputed_vks.begin() + static_cast<std::ptrdiff_t>(end));
+            ivc.accumulate_batch(circuits, vks);
+        }
+    }
 };
 
 /**
@@ -271,6 +360,68 @@ BENCHMARK_DEFINE_F(ClientIVCBench, Translator)(benchmark::State& state)
     }
 }
 
+/**
+ * @brief Benchmark the prover work for the full PG-Goblin IVC protocol when folding several circuits per round
+ * @details The second argument is the number of circuits folded per round; the "construct_circuits" op count captures
+ * the cost of the (fewer, larger) recursive folding verifiers
+ *
+ */
+BENCHMARK_DEFINE_F(ClientIVCBench, FullBatched)(benchmark::State& state)
+{
+    ClientIVC ivc;
+
+    auto num_circuits = static_cast<size_t>(state.range(0));
+    auto batch_size = static_cast<size_t>(state.range(1));
+    auto precomputed_vks = precompute_verification_keys(ivc, num_circuits, batch_size);
+
+    for (auto _ : state) {
+        BB_REPORT_OP_COUNT_IN_BENCH(state);
+        // Perform a specified number of iterations of function/kernel accumulation
+        perform_batched_ivc_accumulation_rounds(num_circuits, batch_size, ivc, precomputed_vks);
+
+        // Construct IVC scheme proof (fold, decider, merge, eccvm, translator)
+        ivc.prove();
+    }
+}
+
+/**
+ * @brief Benchmark only the accumulation rounds when folding several circuits per round
+ *
+ */
+BENCHMARK_DEFINE_F(ClientIVCBench, AccumulateBatched)(benchmark::State& state)
+{
+    ClientIVC ivc;
+
+    auto num_circuits = static_cast<size_t>(state.range(0));
+    auto batch_size = static_cast<size_t>(state.range(1));
+    auto precomputed_vks = precompute_verification_keys(ivc, num_circuits, batch_size);
+
+    // Perform a specified number of iterations of function/kernel accumulation
+    for (auto _ : state) {
+        BB_REPORT_OP_COUNT_IN_BENCH(state);
+        perform_batched_ivc_accumulation_rounds(num_circuits, batch_size, ivc, precomputed_vks);
+    }
+}
+
+/**
+ * @brief Benchmark only the accumulation rounds, overlapping the construction of each circuit with the fold of the
+ * previous one
+ *
+ */
+BENCHMARK_DEFINE_F(ClientIVCBench, AccumulateAsync)(benchmark::State& state)
+{
+    ClientIVC ivc;
+
+    auto num_circuits = static_cast<size_t>(state.range(0));
+    auto precomputed_vks = precompute_verification_keys(ivc, num_circuits);
+
+    // Perform a specified number of iterations of function/kernel accumulation
+    for (auto _ : state) {
+        BB_REPORT_OP_COUNT_IN_BENCH(state);
+        perform_async_ivc_accumulation_rounds(num_circuits, ivc, precomputed_vks);
+    }
+}
+
 #define ARGS                                                                                                           \
     Arg(ClientIVCBench::NUM_ITERATIONS_MEDIUM_COMPLEXITY)                                                              \
         ->Arg(1 << 1)                                                                                                  \
@@ -283,10 +434,22 @@ BENCHMARK_DEFINE_F(ClientIVCBench, Translator)(benchmark::State& state)
 BENCHMARK_REGISTER_F(ClientIVCBench, Full)->Unit(benchmark::kMillisecond)->ARGS;
 BENCHMARK_REGISTER_F(ClientIVCBench, FullStructured)->Unit(benchmark::kMillisecond)->ARGS;
 BENCHMARK_REGISTER_F(ClientIVCBench, Accumulate)->Unit(benchmark::kMillisecond)->ARGS;
+BENCHMARK_REGISTER_F(ClientIVCBench, AccumulateAsync)->Unit(benchmark::kMillisecond)->ARGS;
 BENCHMARK_REGISTER_F(ClientIVCBench, Decide)->Unit(benchmark::kMillisecond)->ARGS;
 BENCHMARK_REGISTER_F(ClientIVCBench, ECCVM)->Unit(benchmark::kMillisecond)->ARGS;
 BENCHMARK_REGISTER_F(ClientIVCBench, Translator)->Unit(benchmark::kMillisecond)->ARGS;
 
+#define BATCHED_ARGS                                                                                                   \
+    Args({ ClientIVCBench::NUM_ITERATIONS_MEDIUM_COMPLEXITY, 1 })                                                      \
+        ->Args({ ClientIVCBench::NUM_ITERATIONS_MEDIUM_COMPLEXITY, 2 })                                                \
+        ->Args({ ClientIVCBench::NUM_ITERATIONS_MEDIUM_COMPLEXITY, 3 })                                                \
+        ->Args({ 1 << 3, 1 })                                                                                          \
+        ->Args({ 1 << 3, 2 })                                                                                          \
+        ->Args({ 1 << 3, 3 })
+
+BENCHMARK_REGISTER_F(ClientIVCBench, FullBatched)->Unit(benchmark::kMillisecond)->BATCHED_ARGS;
+BENCHMARK_REGISTER_F(ClientIVCBench, AccumulateBatched)->Unit(benchmark::kMillisecond)->BATCHED_ARGS;
+
 } // namespace
 
 BENCHMARK_MAIN();
@@ -0,0 +1,134 @@
+/**
+ * @file parallel_for.bench.cpp
+ * @brief Compares the parallel_for backends in common/ on the grain sizes seen in our hot loops
+ * @details "coarse" mimics run_loop_in_parallel (one iteration per cpu, each doing a large contiguous chunk of work, as
+ * in commitments and FFTs). "fine" splits the same amount of work into many small iterations, as in sumcheck partial
+ * evaluation or the combiner over many polynomials, which is where per-iteration locking shows up. "nested" runs a
+ * parallel_for inside each iteration of another one; only the work-stealing backend supports this.
+ */
+#include "barretenberg/common/thread.hpp"
+#include "barretenberg/ecc/curves/bn254/fr.hpp"
+#include <benchmark/benchmark.h>
+
+using namespace benchmark;
+using namespace bb;
+
+#ifndef NO_MULTITHREADING
+namespace bb {
+// Defined in common/parallel_for_*.cpp. Only the selected one is reachable through bb::parallel_for.
+void parallel_for_omp(size_t num_iterations, const std::function<void(size_t)>& func);
+void parallel_for_spawning(size_t num_iterations, const std::function<void(size_t)>& func);
+void parallel_for_queued(size_t num_iterations, const std::function<void(size_t)>& func);
+void parallel_for_atomic_pool(size_t num_iterations, const std::function<void(size_t)>& func);
+void parallel_for_mutex_pool(size_t num_iterations, const std::function<void(size_t)>& func);
+void parallel_for_work_stealing(size_t num_iterations, const std::function<void(size_t)>& func);
+} // namespace bb
+
+namespace {
+using ParallelFor = void (*)(size_t, const std::function<void(size_t)>&);
+
+constexpr size_t TOTAL_WORK_LOG = 18;
+
+/**
+ * @brief Multiply a chunk of field elements in place, the unit of work for all benchmarks
+ */
+void multiply_range(std::vector<fr>& elements, const fr& multiplier, size_t start, size_t end)
+{
+    for (size_t i = start; i < end; ++i) {
+        elements[i] *= multiplier;
+    }
+}
+
+template <ParallelFor parallel_for_impl> void coarse(State& state)
+{
+    const size_t num_elements = 1UL << static_cast<size_t>(state.range(0));
+    std::vector<fr> elements(num_elements, fr::random_element());
+    const fr multiplier = fr::random_element();
+    const size_t num_cpus = get_num_cpus();
+    const size_t chunk_size = (num_elements + num_cpus - 1) / num_cpus;
+    for (auto _ : state) {
+        parallel_for_impl(num_cpus, [&](size_t chunk_index) {
+            const size_t start = std::min(chunk_index * chunk_size, num_elements);
+            multiply_range(elements, multiplier, start, std::min(start + chunk_size, num_elements));
+        });
+        DoNotOptimize(elements[0]);
+    }
+}
+
+/**
+ * @brief The same 2^TOTAL_WORK_LOG multiplications split into iterations of 2^range(0) multiplications each
+ */
+template <ParallelFor parallel_for_impl> void fine(State& state)
+{
+    const size_t num_elements = 1UL << TOTAL_WORK_LOG;
+    const size_t grain_size = 1UL << static_cast<size_t>(state.range(0));
+    std::vector<fr> elements(num_elements, fr::random_element());
+    const fr multiplier = fr::random_element();
+    for (auto _ : state) {
+        parallel_for_impl(num_elements / grain_size, [&](size_t index) {
+            multiply_range(elements, multiplier, index * grain_size, (index + 1) * grain_size);
+        });
+        DoNotOptimize(elements[0]);
+    }
+}
+
+/**
+ * @brief An outer loop over "polynomials" with an inner parallel loop over their rows
+ */
+void nested_work_stealing(State& state)
+{
+    const size_t num_outer = 1UL << static_cast<size_t>(state.range(0));
+    const size_t num_elements = 1UL << TOTAL_WORK_LOG;
+    const size_t inner_size = num_elements / num_outer;
+    constexpr size_t INNER_GRAIN = 1 << 8;
+    std::vector<fr> elements(num_elements, fr::random_element());
+    const fr multiplier = fr::random_element();
+    for (auto _ : state) {
+        parallel_for_work_stealing(num_outer, [&](size_t outer) {
+            const size_t offset = outer * inner_size;
+            const size_t num_inner = std::max(inner_size / INNER_GRAIN, size_t(1));
+            const size_t inner_grain = inner_size / num_inner;
+            parallel_for_work_stealing(num_inner, [&](size_t inner) {
+                const size_t start = offset + inner * inner_grain;
+                multiply_range(elements, multiplier, start, start + inner_grain);
+            });
+        });
+        DoNotOptimize(elements[0]);
+    }
+}
+
+void reduce_work_stealing(State& state)
+{
+    const size_t num_elements = 1UL << static_cast<size_t>(state.range(0));
+    std::vector<fr> elements(num_elements, fr::random_element());
+    for (auto _ : state) {
+        DoNotOptimize(parallel_reduce(
+            num_elements,
+            fr::zero(),
+            [&](size_t start, size_t end) {
+                fr sum = fr::zero();
+                for (size_t i = start; i < end; ++i) {
+                    sum += elements[i] * elements[i];
+                }
+                return sum;
+            },
+            [](const fr& a, const fr& b) { return a + b; }));
+    }
+}
+} // namespace
+
+#define PARALLEL_FOR_BENCHMARKS(backend)                                                                               \
+    BENCHMARK_TEMPLATE(coarse, backend)->Unit(kMicrosecond)->DenseRange(12, 20, 2);                                   \
+    BENCHMARK_TEMPLATE(fine, backend)->Unit(kMicrosecond)->DenseRange(2, 12, 2);
+
+PARALLEL_FOR_BENCHMARKS(parallel_for_omp);
+PARALLEL_FOR_BENCHMARKS(parallel_for_spawning);
+PARALLEL_FOR_BENCHMARKS(parallel_for_queued);
+PARALLEL_FOR_BENCHMARKS(parallel_for_atomic_pool);
+PARALLEL_FOR_BENCHMARKS(parallel_for_mutex_pool);
+PARALLEL_FOR_BENCHMARKS(parallel_for_work_stealing);
+BENCHMARK(nested_work_stealing)->Unit(kMicrosecond)->DenseRange(0, 10, 2);
+BENCHMARK(reduce_work_stealing)->Unit(kMicrosecond)->DenseRange(12, 20, 4);
+#endif
+
+BENCHMARK_MAIN();
@@ -1,6 +1,7 @@
 #include "barretenberg/common/assert.hpp"
 #include "barretenberg/ecc/curves/bn254/bn254.hpp"
 #include "barretenberg/ecc/scalar_multiplication/scalar_multiplication.hpp"
+#include "barretenberg/ecc/scalar_multiplication/signed_digit_msm.hpp"
 #include "barretenberg/polynomials/polynomial_arithmetic.hpp"
 #include "barretenberg/srs/factories/file_crs_factory.hpp"
 
@@ -80,6 +81,27 @@ int pippenger()
     return 0;
 }
 
+// Time each MSM engine over a range of sizes, see scalar_multiplication::MsmEngine
+int msm_engines()
+{
+    using scalar_multiplication::MsmEngine;
+    scalar_multiplication::pippenger_runtime_state<curve::BN254> state(NUM_POINTS);
+    for (size_t num_points = 1 << 8; num_points <= NUM_POINTS; num_points <<= 2) {
+        for (auto [engine, name] : { std::pair{ MsmEngine::PIPPENGER_WNAF, "pippenger wnaf" },
+                                     std::pair{ MsmEngine::SIGNED_DIGIT_AFFINE, "signed digit affine" } }) {
+            std::chrono::steady_clock::time_point time_start = std::chrono::steady_clock::now();
+            g1::element result = scalar_multiplication::msm<curve::BN254>(
+                &scalars[0], reference_string->get_monomial_points(), num_points, state, engine);
+            std::chrono::steady_clock::time_point time_end = std::chrono::steady_clock::now();
+            std::chrono::microseconds diff =
+                std::chrono::duration_cast<std::chrono::microseconds>(time_end - time_start);
+            std::cout << name << " msm of size " << num_points << ": " << diff.count() << "us" << std::endl;
+            static_cast<void>(result);
+        }
+    }
+    return 0;
+}
+
 int coset_fft_split()
 {
     std::chrono::steady_clock::time_point time_start = std::chrono::steady_clock::now();
@@ -115,5 +137,7 @@ int main()
     pippenger();
     pippenger();
     pippenger();
+    std::cout << "executing msm engines" << std::endl;
+    msm_engines();
     return 0;
 }
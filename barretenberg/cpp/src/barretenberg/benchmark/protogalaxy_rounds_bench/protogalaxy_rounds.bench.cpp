@@ -46,6 +46,42 @@ void _bench_round(::benchmark::State& state, void (*F)(ProtoGalaxyProver_<Prover
     }
 }
 
+/**
+ * @brief Time the perturbator of an accumulator produced by folding two circuits that fill half of the trace, as the
+ * padded circuits folded in the ClientIVC do, with or without the active row ranges recorded by the fold.
+ */
+template <typename Flavor> void _bench_perturbator(::benchmark::State& state, bool use_active_row_ranges)
+{
+    using Builder = typename Flavor::CircuitBuilder;
+    using FF = typename Flavor::FF;
+    using ProverInstance = ProverInstance_<Flavor>;
+    using Instances = ProverInstances_<Flavor, 2>;
+    using ProtoGalaxyProver = ProtoGalaxyProver_<Instances>;
+
+    bb::srs::init_crs_factory("../srs_db/ignition");
+    auto log2_num_gates = static_cast<size_t>(state.range(0));
+
+    const auto construct_instance = [&]() {
+        Builder builder;
+        MockCircuits::construct_arithmetic_circuit(builder, log2_num_gates - 1);
+        // Overflow into the next power of two
+        MockCircuits::add_arithmetic_gates(builder, 1 << 4);
+        return std::make_shared<ProverInstance>(builder);
+    };
+
+    ProtoGalaxyProver folding_prover({ construct_instance(), construct_instance() });
+    std::shared_ptr<ProverInstance> accumulator = folding_prover.fold_instances().accumulator;
+    if (!use_active_row_ranges) {
+        accumulator->active_row_ranges = std::nullopt;
+    }
+    const auto deltas =
+        ProtoGalaxyProver::compute_round_challenge_pows(accumulator->proving_key.log_circuit_size, FF::random_element());
+
+    for (auto _ : state) {
+        DoNotOptimize(ProtoGalaxyProver::compute_perturbator(accumulator, deltas));
+    }
+}
+
 void bench_round_ultra(::benchmark::State& state, void (*F)(ProtoGalaxyProver_<ProverInstances_<UltraFlavor, 2>>&))
 {
     _bench_round<UltraFlavor>(state, F);
@@ -56,6 +92,16 @@ void bench_round_mega(::benchmark::State& state, void (*F)(ProtoGalaxyProver_<Pr
     _bench_round<MegaFlavor>(state, F);
 }
 
+void bench_perturbator_ultra(::benchmark::State& state, bool use_active_row_ranges)
+{
+    _bench_perturbator<UltraFlavor>(state, use_active_row_ranges);
+}
+
+void bench_perturbator_mega(::benchmark::State& state, bool use_active_row_ranges)
+{
+    _bench_perturbator<MegaFlavor>(state, use_active_row_ranges);
+}
+
 BENCHMARK_CAPTURE(bench_round_ultra, preparation, [](auto& prover) { prover.preparation_round(); })
     -> DenseRange(14, 20) -> Unit(kMillisecond);
 BENCHMARK_CAPTURE(bench_round_ultra, perturbator, [](auto& prover) { prover.perturbator_round(); })
@@ -74,6 +120,11 @@ BENCHMARK_CAPTURE(bench_round_mega, combiner_quotient, [](auto& prover) { prover
 BENCHMARK_CAPTURE(bench_round_mega, accumulator_update, [](auto& prover) { prover.accumulator_update_round(); })
     -> DenseRange(14, 20) -> Unit(kMillisecond);
 
+BENCHMARK_CAPTURE(bench_perturbator_ultra, all_rows, false) -> DenseRange(14, 20) -> Unit(kMillisecond);
+BENCHMARK_CAPTURE(bench_perturbator_ultra, active_rows, true) -> DenseRange(14, 20) -> Unit(kMillisecond);
+BENCHMARK_CAPTURE(bench_perturbator_mega, all_rows, false) -> DenseRange(14, 20) -> Unit(kMillisecond);
+BENCHMARK_CAPTURE(bench_perturbator_mega, active_rows, true) -> DenseRange(14, 20) -> Unit(kMillisecond);
+
 } // namespace bb
 
 BENCHMARK_MAIN();
@@ -0,0 +1,90 @@
+#include "barretenberg/stdlib_circuit_builders/mega_flavor.hpp"
+#include "barretenberg/stdlib_circuit_builders/ultra_flavor.hpp"
+#include "barretenberg/sumcheck/sumcheck.hpp"
+#ifndef DISABLE_AZTEC_VM
+#include "barretenberg/vm/avm/generated/flavor.hpp"
+#endif
+#include <benchmark/benchmark.h>
+
+using namespace benchmark;
+
+namespace {
+auto& engine = bb::numeric::get_debug_randomness();
+}
+
+namespace bb::benchmark {
+
+/**
+ * @brief Fold the book-keeping table one column per thread, as sumcheck did before it split the rows into tiles
+ */
+template <typename FF>
+void fold_per_column(auto& partially_evaluated_polynomials, auto& polynomials, size_t round_size, FF round_challenge)
+{
+    auto pep_view = partially_evaluated_polynomials.get_all();
+    auto poly_view = polynomials.get_all();
+    parallel_for(poly_view.size(), [&](size_t j) {
+        FF::batch_fold(std::span<FF>{ pep_view[j] }.first(round_size >> 1),
+                       std::span<const FF>{ poly_view[j] }.first(round_size),
+                       round_challenge);
+    });
+}
+
+/**
+ * @brief Run the partial evaluations of every sumcheck round on dense columns of 2^state.range(0) rows
+ */
+template <typename Flavor, bool tiled> void partially_evaluate_all_rounds(State& state) noexcept
+{
+    using FF = typename Flavor::FF;
+    const size_t circuit_size = 1 << static_cast<size_t>(state.range(0));
+
+    // A table of full-size columns, filled with distinct non-zero values
+    typename Flavor::PartiallyEvaluatedMultivariates full_polynomials(2 * circuit_size);
+    FF value = FF::random_element(&engine);
+    const FF step = FF::random_element(&engine);
+    for (auto& poly : full_polynomials.get_all()) {
+        for (auto& coeff : poly) {
+            coeff = value;
+            value += step;
+        }
+    }
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        SumcheckProver<Flavor> sumcheck(circuit_size, std::make_shared<typename Flavor::Transcript>());
+        state.ResumeTiming();
+
+        for (size_t round_size = circuit_size; round_size > 1; round_size >>= 1) {
+            const FF round_challenge = FF::random_element(&engine);
+            if (round_size == circuit_size) {
+                if constexpr (tiled) {
+                    sumcheck.partially_evaluate(full_polynomials, round_size, round_challenge);
+                } else {
+                    fold_per_column(
+                        sumcheck.partially_evaluated_polynomials, full_polynomials, round_size, round_challenge);
+                }
+            } else {
+                if constexpr (tiled) {
+                    sumcheck.partially_evaluate(sumcheck.partially_evaluated_polynomials, round_size, round_challenge);
+                } else {
+                    fold_per_column(sumcheck.partially_evaluated_polynomials,
+                                    sumcheck.partially_evaluated_polynomials,
+                                    round_size,
+                                    round_challenge);
+                }
+            }
+        }
+    }
+}
+
+BENCHMARK(partially_evaluate_all_rounds<UltraFlavor, false>)->DenseRange(12, 18, 2)->Unit(kMillisecond);
+BENCHMARK(partially_evaluate_all_rounds<UltraFlavor, true>)->DenseRange(12, 18, 2)->Unit(kMillisecond);
+BENCHMARK(partially_evaluate_all_rounds<MegaFlavor, false>)->DenseRange(12, 18, 2)->Unit(kMillisecond);
+BENCHMARK(partially_evaluate_all_rounds<MegaFlavor, true>)->DenseRange(12, 18, 2)->Unit(kMillisecond);
+#ifndef DISABLE_AZTEC_VM
+BENCHMARK(partially_evaluate_all_rounds<AvmFlavor, false>)->DenseRange(10, 16, 2)->Unit(kMillisecond);
+BENCHMARK(partially_evaluate_all_rounds<AvmFlavor, true>)->DenseRange(10, 16, 2)->Unit(kMillisecond);
+#endif
+
+} // namespace bb::benchmark
+
+BENCHMARK_MAIN();
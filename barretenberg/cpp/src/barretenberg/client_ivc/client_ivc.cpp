@@ -1,8 +1,31 @@
 #include "barretenberg/client_ivc/client_ivc.hpp"
+#include "barretenberg/common/throw_or_abort.hpp"
 #include "tracy/Tracy.hpp"
 
 namespace bb {
 
+namespace {
+/**
+ * @brief Invoke fn with a std::integral_constant holding the runtime number of instances being folded
+ * @details Protogalaxy fixes the number of instances at compile time; this selects the instantiation matching a fold of
+ * the accumulator with between 1 and MAX_BATCH_SIZE incoming instances.
+ */
+template <size_t NUM = 2, typename Fn> auto dispatch_on_num_instances(const size_t num_instances, Fn&& fn)
+{
+    if constexpr (NUM == ClientIVC::MAX_BATCH_SIZE + 1) {
+        if (num_instances != NUM) {
+            throw_or_abort("ClientIVC: number of instances to fold must be between 2 and MAX_BATCH_SIZE + 1");
+        }
+        return fn(std::integral_constant<size_t, NUM>{});
+    } else {
+        if (num_instances == NUM) {
+            return fn(std::integral_constant<size_t, NUM>{});
+        }
+        return dispatch_on_num_instances<NUM + 1>(num_instances, std::forward<Fn>(fn));
+    }
+}
+} // namespace
+
 /**
  * @brief Accumulate a circuit into the IVC scheme
  * @details If this is the first circuit being accumulated, initialize the prover and verifier accumulators. Otherwise,
@@ -15,14 +38,140 @@ namespace bb {
  */
 void ClientIVC::accumulate(ClientCircuit& circuit, const std::shared_ptr<VerificationKey>& precomputed_vk)
 {
+    wait_for_accumulation();
+
     // If a previous fold proof exists, add a recursive folding verification to the circuit
-    if (!fold_output.proof.empty()) {
-        BB_OP_COUNT_TIME_NAME("construct_circuits");
-        FoldingRecursiveVerifier verifier{ &circuit, { verifier_accumulator, { instance_vk } } };
-        auto verifier_accum = verifier.verify_folding_proof(fold_output.proof);
-        verifier_accumulator = std::make_shared<VerifierInstance>(verifier_accum->get_value());
+    recursively_verify_previous_fold(circuit);
+
+    // Construct a merge proof and the prover instance for the circuit
+    construct_instance(circuit);
+
+    // Initialize the accumulators with the instance or fold it into the prover accumulator
+    complete_accumulation(precomputed_vk);
+}
+
+/**
+ * @brief Accumulate a circuit into the IVC scheme, completing the accumulation in the background
+ * @details Equivalent to accumulate, except that only the steps which read or extend the circuit and the op queue
+ * (recursive verification of the previous fold, merge proof and prover instance construction) run on the calling
+ * thread. Computation of the verification key and the fold itself, which account for most of the cost of a round, are
+ * handed to a separate thread so that the caller can meanwhile generate the witness for the next circuit.
+ *
+ * Since each circuit recursively verifies the fold proof produced for its predecessor, a round cannot start before
+ * the previous one is complete; this call (like every other method consuming IVC state) therefore first waits for any
+ * accumulation still in flight. At most one instance is thus held in memory beyond the accumulator at any time.
+ * @note The background task only touches the instance, its VK and the fold state, so the op queue (which is complete
+ * for this circuit once the call returns) may be read while it runs; the other members must not be accessed directly
+ * until the returned future is ready. Without multithreading, the accumulation is completed before returning.
+ *
+ * @param circuit Circuit to be accumulated/folded; it is no longer needed once this call returns
+ * @param precomputed_vk Optional precomputed VK (otherwise will be computed in the background)
+ * @return std::future<void> Becomes ready once the circuit has been accumulated
+ */
+std::future<void> ClientIVC::accumulate_async(ClientCircuit& circuit,
+                                              const std::shared_ptr<VerificationKey>& precomputed_vk)
+{
+    wait_for_accumulation();
+
+    recursively_verify_previous_fold(circuit);
+    construct_instance(circuit);
+
+    auto accumulated = std::make_shared<std::promise<void>>();
+    auto result = accumulated->get_future();
+#ifdef NO_MULTITHREADING
+    complete_accumulation(precomputed_vk);
+    accumulated->set_value();
+#else
+    // Should the task fail, its exception is rethrown by the next wait and the returned future reports a broken promise
+    pending_accumulation = std::async(std::launch::async, [this, precomputed_vk, accumulated]() {
+        complete_accumulation(precomputed_vk);
+        accumulated->set_value();
+    });
+#endif
+    return result;
+}
+
+/**
+ * @brief Block until the accumulation started by the most recent call to accumulate_async (if any) is complete
+ */
+void ClientIVC::wait_for_accumulation()
+{
+    if (pending_accumulation.valid()) {
+        pending_accumulation.get();
+    }
+}
+
+/**
+ * @brief Accumulate several circuits into the IVC scheme with a single fold
+ * @details Equivalent to calling accumulate on each circuit in turn, except that the instances are folded into the
+ * accumulator all at once. The resulting fold proof is therefore verified (recursively) only once, in the first circuit
+ * of the next batch, rather than once per circuit. If the IVC is uninitialized, the first circuit initializes the
+ * accumulators and the remaining ones are folded.
+ *
+ * @param circuits Between 1 and MAX_BATCH_SIZE circuits to be accumulated; each is merged in order
+ * @param precomputed_vks Optional precomputed VKs, one per circuit (otherwise will be computed herein)
+ */
+void ClientIVC::accumulate_batch(std::vector<ClientCircuit>& circuits,
+                                 const std::vector<std::shared_ptr<VerificationKey>>& precomputed_vks)
+{
+    wait_for_accumulation();
+    if (circuits.empty() || circuits.size() > MAX_BATCH_SIZE + (initialized ? 0 : 1)) {
+        throw_or_abort("ClientIVC: batch must hold 1 to MAX_BATCH_SIZE circuits, plus one when uninitialized");
+    }
+    if (!precomputed_vks.empty() && precomputed_vks.size() != circuits.size()) {
+        throw_or_abort("ClientIVC: batch must be given either no precomputed VKs or one per circuit");
+    }
+
+    // A single recursive folding verification (of a proof which may itself fold several instances) suffices per batch
+    recursively_verify_previous_fold(circuits[0]);
+
+    std::vector<std::shared_ptr<ProverInstance>> instances;
+    std::vector<std::shared_ptr<VerificationKey>> vks;
+    for (size_t idx = 0; idx < circuits.size(); ++idx) {
+        construct_instance(circuits[idx]);
+        set_instance_vk(precomputed_vks.empty() ? nullptr : precomputed_vks[idx]);
+        if (!initialized) {
+            fold_output.accumulator = prover_instance;
+            verifier_accumulator = std::make_shared<VerifierInstance>(instance_vk);
+            initialized = true;
+            continue;
+        }
+        instances.emplace_back(prover_instance);
+        vks.emplace_back(instance_vk);
     }
 
+    if (!instances.empty()) {
+        fold(instances, vks);
+    }
+}
+
+/**
+ * @brief If a previous fold proof exists, append a recursive verifier for it to the circuit and update the verifier
+ * accumulator accordingly
+ */
+void ClientIVC::recursively_verify_previous_fold(ClientCircuit& circuit)
+{
+    if (fold_output.proof.empty()) {
+        return;
+    }
+    BB_OP_COUNT_TIME_NAME("construct_circuits");
+    verifier_accumulator = dispatch_on_num_instances(batch_vks.size() + 1, [&](auto num_instances) {
+        using RecursiveInstances =
+            stdlib::recursion::honk::RecursiveVerifierInstances_<GURecursiveFlavor, decltype(num_instances)::value>;
+        stdlib::recursion::honk::ProtoGalaxyRecursiveVerifier_<RecursiveInstances> verifier{
+            &circuit, { verifier_accumulator, batch_vks }
+        };
+        auto verifier_accum = verifier.verify_folding_proof(fold_output.proof);
+        return std::make_shared<VerifierInstance>(verifier_accum->get_value());
+    });
+}
+
+/**
+ * @brief Construct a merge proof (adding a recursive merge verifier to the circuit if a previous merge proof exists),
+ * then the prover instance for the circuit
+ */
+void ClientIVC::construct_instance(ClientCircuit& circuit)
+{
     // Construct a merge proof (and add a recursive merge verifier to the circuit if a previous merge proof exists)
     goblin.merge(circuit);
 
@@ -31,25 +180,57 @@ void ClientIVC::accumulate(ClientCircuit& circuit, const std::shared_ptr<Verific
 
     // Track the maximum size of each block for all circuits porcessed (for debugging purposes only)
     max_block_size_tracker.update(circuit);
+}
 
-    // Set the instance verification key from precomputed if available, else compute it
+/**
+ * @brief Set the verification key of the most recently constructed instance from precomputed if available, else
+ * compute it
+ */
+void ClientIVC::set_instance_vk(const std::shared_ptr<VerificationKey>& precomputed_vk)
+{
     if (precomputed_vk) {
         instance_vk = precomputed_vk;
     } else {
         instance_vk = std::make_shared<VerificationKey>(prover_instance->proving_key);
     }
+}
+
+/**
+ * @brief Set the verification key of the most recently constructed instance, then, if the IVC is uninitialized, simply
+ * initialize the prover and verifier accumulator instances with it; otherwise fold it into the accumulator
+ */
+void ClientIVC::complete_accumulation(const std::shared_ptr<VerificationKey>& precomputed_vk)
+{
+    set_instance_vk(precomputed_vk);
 
-    // If the IVC is uninitialized, simply initialize the prover and verifier accumulator instances
     if (!initialized) {
         fold_output.accumulator = prover_instance;
         verifier_accumulator = std::make_shared<VerifierInstance>(instance_vk);
         initialized = true;
-    } else { // Otherwise, fold the new instance into the accumulator
-        FoldingProver folding_prover({ fold_output.accumulator, prover_instance });
-        fold_output = folding_prover.fold_instances();
+    } else {
+        fold({ prover_instance }, { instance_vk });
     }
 }
 
+/**
+ * @brief Fold the given instances into the prover accumulator with a single Protogalaxy proof
+ *
+ * @param instances The incoming prover instances
+ * @param vks Their verification keys, retained for the recursive verification of the resulting fold proof
+ */
+void ClientIVC::fold(const std::vector<std::shared_ptr<ProverInstance>>& instances,
+                     const std::vector<std::shared_ptr<VerificationKey>>& vks)
+{
+    batch_vks = vks;
+
+    std::vector<std::shared_ptr<ProverInstance>> prover_instances{ fold_output.accumulator };
+    prover_instances.insert(prover_instances.end(), instances.begin(), instances.end());
+    fold_output = dispatch_on_num_instances(prover_instances.size(), [&](auto num_instances) {
+        ProtoGalaxyProver_<ProverInstances_<Flavor, decltype(num_instances)::value>> folding_prover(prover_instances);
+        return folding_prover.fold_instances();
+    });
+}
+
 /**
  * @brief Construct a proof for the IVC, which, if verified, fully establishes its correctness
  *
@@ -58,6 +239,7 @@ void ClientIVC::accumulate(ClientCircuit& circuit, const std::shared_ptr<Verific
 ClientIVC::Proof ClientIVC::prove()
 {
     ZoneScoped;
+    wait_for_accumulation();
     max_block_size_tracker.print(); // print minimum structured sizes for each block
     return { fold_output.proof, decider_prove(), goblin.prove() };
 };
@@ -67,14 +249,30 @@ bool ClientIVC::verify(const Proof& proof,
                        const std::shared_ptr<VerifierInstance>& final_verifier_instance,
                        const std::shared_ptr<ClientIVC::ECCVMVerificationKey>& eccvm_vk,
                        const std::shared_ptr<ClientIVC::TranslatorVerificationKey>& translator_vk)
+{
+    return verify(proof, { accumulator, final_verifier_instance }, eccvm_vk, translator_vk);
+}
+
+/**
+ * @brief Verify a full proof of the IVC whose final fold may have folded several instances into the accumulator
+ *
+ * @param verifier_instances The verifier accumulator followed by the instances folded by the final fold proof
+ */
+bool ClientIVC::verify(const Proof& proof,
+                       const std::vector<std::shared_ptr<VerifierInstance>>& verifier_instances,
+                       const std::shared_ptr<ClientIVC::ECCVMVerificationKey>& eccvm_vk,
+                       const std::shared_ptr<ClientIVC::TranslatorVerificationKey>& translator_vk)
 {
     // Goblin verification (merge, eccvm, translator)
     GoblinVerifier goblin_verifier{ eccvm_vk, translator_vk };
     bool goblin_verified = goblin_verifier.verify(proof.goblin_proof);
 
     // Decider verification
-    ClientIVC::FoldingVerifier folding_verifier({ accumulator, final_verifier_instance });
-    auto verifier_accumulator = folding_verifier.verify_folding_proof(proof.folding_proof);
+    auto verifier_accumulator = dispatch_on_num_instances(verifier_instances.size(), [&](auto num_instances) {
+        ProtoGalaxyVerifier_<VerifierInstances_<Flavor, decltype(num_instances)::value>> folding_verifier(
+            verifier_instances);
+        return folding_verifier.verify_folding_proof(proof.folding_proof);
+    });
 
     ClientIVC::DeciderVerifier decider_verifier(verifier_accumulator);
     bool decision = decider_verifier.verify_proof(proof.decider_proof);
@@ -91,17 +289,19 @@ bool ClientIVC::verify(Proof& proof, const std::vector<std::shared_ptr<VerifierI
 {
     auto eccvm_vk = std::make_shared<ECCVMVerificationKey>(goblin.get_eccvm_proving_key());
     auto translator_vk = std::make_shared<TranslatorVerificationKey>(goblin.get_translator_proving_key());
-    return verify(proof, verifier_instances[0], verifier_instances[1], eccvm_vk, translator_vk);
+    return verify(proof, verifier_instances, eccvm_vk, translator_vk);
 }
 
 /**
  * @brief Internal method for constructing a decider proof
+ * @pre No accumulation is in flight (see wait_for_accumulation)
  *
  * @return HonkProof
  */
 HonkProof ClientIVC::decider_prove() const
 {
     MegaDeciderProver decider_prover(fold_output.accumulator);
+    decider_prover.low_memory_sumcheck = low_memory_sumcheck;
     return decider_prover.construct_proof();
 }
 
@@ -115,16 +315,36 @@ HonkProof ClientIVC::decider_prove() const
  * (albeit innefficient) way of separating out the cost of computing VKs from a benchmark.
  *
  * @param circuits A copy of the circuits to be accumulated (passing by reference would alter the original circuits)
+ * @param batch_size If greater than one, the VKs are computed for accumulation via accumulate_batch where the first
+ * circuit initializes the IVC and the remaining ones are accumulated in consecutive batches of (at most) this size.
+ * Must be between 1 and MAX_BATCH_SIZE.
  * @return std::vector<std::shared_ptr<ClientIVC::VerificationKey>>
  */
 std::vector<std::shared_ptr<ClientIVC::VerificationKey>> ClientIVC::precompute_folding_verification_keys(
-    std::vector<ClientCircuit> circuits)
+    std::vector<ClientCircuit> circuits, const size_t batch_size)
 {
+    if (batch_size == 0 || batch_size > MAX_BATCH_SIZE) {
+        throw_or_abort("ClientIVC: folding batch size must be between 1 and MAX_BATCH_SIZE");
+    }
+
     std::vector<std::shared_ptr<VerificationKey>> vkeys;
 
-    for (auto& circuit : circuits) {
-        accumulate(circuit);
+    if (batch_size == 1) {
+        for (auto& circuit : circuits) {
+            accumulate(circuit);
+            vkeys.emplace_back(instance_vk);
+        }
+    } else {
+        accumulate(circuits[0]);
         vkeys.emplace_back(instance_vk);
+        for (size_t start = 1; start < circuits.size(); start += batch_size) {
+            const size_t end = std::min(start + batch_size, circuits.size());
+            std::vector<ClientCircuit> batch(
+                std::make_move_iterator(circuits.begin() + static_cast<std::ptrdiff_t>(start)),
+                std::make_move_iterator(circuits.begin() + static_cast<std::ptrdiff_t>(end)));
+            accumulate_batch(batch);
+            vkeys.insert(vkeys.end(), batch_vks.begin(), batch_vks.end());
+        }
     }
 
     // Reset the scheme so it can be reused for actual accumulation, maintaining the trace structure setting as is
@@ -145,8 +365,11 @@ bool ClientIVC::prove_and_verify()
 {
     auto proof = prove();
 
-    auto verifier_inst = std::make_shared<VerifierInstance>(this->instance_vk);
-    return verify(proof, { this->verifier_accumulator, verifier_inst });
+    std::vector<std::shared_ptr<VerifierInstance>> verifier_instances{ this->verifier_accumulator };
+    for (auto& vk : this->batch_vks) {
+        verifier_instances.emplace_back(std::make_shared<VerifierInstance>(vk));
+    }
+    return verify(proof, verifier_instances);
 }
 
 } // namespace bb
\ No newline at end of file
@@ -9,13 +9,16 @@
 #include "barretenberg/sumcheck/instance/instances.hpp"
 #include "barretenberg/ultra_honk/decider_prover.hpp"
 #include <algorithm>
+#include <future>
 
 namespace bb {
 
 /**
  * @brief The IVC interface to be used by the aztec client for private function execution
  * @details Combines Protogalaxy with Goblin to accumulate one circuit instance at a time with efficient EC group
- * operations
+ * operations. Alternatively, up to MAX_BATCH_SIZE circuits can be folded into the accumulator in a single round via
+ * accumulate_batch, trading a more expensive fold (and recursive fold verifier) for fewer of them. With
+ * accumulate_async, the fold of one circuit runs in the background while the caller constructs the next one.
  *
  */
 class ClientIVC {
@@ -42,6 +45,10 @@ class ClientIVC {
     using FoldingRecursiveVerifier =
         bb::stdlib::recursion::honk::ProtoGalaxyRecursiveVerifier_<RecursiveVerifierInstances>;
 
+    // The maximum number of circuits that can be folded into the accumulator in one round; Protogalaxy supports folding
+    // at most four instances at once, one of which is the accumulator
+    static constexpr size_t MAX_BATCH_SIZE = 3;
+
     // A full proof for the IVC scheme
     struct Proof {
         FoldProof folding_proof; // final fold proof
@@ -70,15 +77,28 @@ class ClientIVC {
     // be needed in the real IVC as they are provided as inputs
     std::shared_ptr<ProverInstance> prover_instance;
     std::shared_ptr<VerificationKey> instance_vk;
+    // The verification keys of the instances folded by the most recent fold proof (the last of which is instance_vk)
+    std::vector<std::shared_ptr<VerificationKey>> batch_vks;
 
     // A flag indicating whether or not to construct a structured trace in the ProverInstance
     TraceStructure trace_structure = TraceStructure::NONE;
 
+    // A flag indicating whether the decider runs sumcheck in its low-memory mode (see SumcheckProver)
+    bool low_memory_sumcheck = false;
+
     // A flag indicating whether the IVC has been initialized with an initial instance
     bool initialized = false;
 
     void accumulate(ClientCircuit& circuit, const std::shared_ptr<VerificationKey>& precomputed_vk = nullptr);
 
+    void accumulate_batch(std::vector<ClientCircuit>& circuits,
+                          const std::vector<std::shared_ptr<VerificationKey>>& precomputed_vks = {});
+
+    std::future<void> accumulate_async(ClientCircuit& circuit,
+                                       const std::shared_ptr<VerificationKey>& precomputed_vk = nullptr);
+
+    void wait_for_accumulation();
+
     Proof prove();
 
     static bool verify(const Proof& proof,
@@ -87,12 +107,34 @@ class ClientIVC {
                        const std::shared_ptr<ClientIVC::ECCVMVerificationKey>& eccvm_vk,
                        const std::shared_ptr<ClientIVC::TranslatorVerificationKey>& translator_vk);
 
+    static bool verify(const Proof& proof,
+                       const std::vector<std::shared_ptr<VerifierInstance>>& verifier_instances,
+                       const std::shared_ptr<ClientIVC::ECCVMVerificationKey>& eccvm_vk,
+                       const std::shared_ptr<ClientIVC::TranslatorVerificationKey>& translator_vk);
+
     bool verify(Proof& proof, const std::vector<std::shared_ptr<VerifierInstance>>& verifier_instances) const;
 
     bool prove_and_verify();
 
     HonkProof decider_prove() const;
 
-    std::vector<std::shared_ptr<VerificationKey>> precompute_folding_verification_keys(std::vector<ClientCircuit>);
+    std::vector<std::shared_ptr<VerificationKey>> precompute_folding_verification_keys(std::vector<ClientCircuit>,
+                                                                                       size_t batch_size = 1);
+
+  private:
+    void recursively_verify_previous_fold(ClientCircuit& circuit);
+
+    void construct_instance(ClientCircuit& circuit);
+
+    void set_instance_vk(const std::shared_ptr<VerificationKey>& precomputed_vk);
+
+    void complete_accumulation(const std::shared_ptr<VerificationKey>& precomputed_vk);
+
+    void fold(const std::vector<std::shared_ptr<ProverInstance>>& instances,
+              const std::vector<std::shared_ptr<VerificationKey>>& vks);
+
+    // The background task of the in-flight accumulate_async call, if any. Declared last so that it is destroyed (and
+    // hence waited on) before any of the state the task operates on.
+    std::future<void> pending_accumulation;
 };
 } // namespace bb
\ No newline at end of file
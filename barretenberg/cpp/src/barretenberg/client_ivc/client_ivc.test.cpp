@@ -161,6 +161,25 @@ TEST_F(ClientIVCTests, BasicStructured)
     EXPECT_TRUE(prove_and_verify(ivc));
 };
 
+/**
+ * @brief The decider can run sumcheck in its low-memory mode, which produces the same proof
+ *
+ */
+TEST_F(ClientIVCTests, LowMemorySumcheck)
+{
+    ClientIVC ivc;
+
+    Builder circuit_0 = create_mock_circuit(ivc);
+    ivc.accumulate(circuit_0);
+    Builder circuit_1 = create_mock_circuit(ivc);
+    ivc.accumulate(circuit_1);
+
+    const HonkProof decider_proof = ivc.decider_prove();
+    ivc.low_memory_sumcheck = true;
+    EXPECT_EQ(ivc.decider_prove(), decider_proof);
+    EXPECT_TRUE(prove_and_verify(ivc));
+};
+
 /**
  * @brief Prove and verify accumulation of an arbitrary set of circuits using precomputed verification keys
  *
@@ -213,3 +232,133 @@ TEST_F(ClientIVCTests, StructuredPrecomputedVKs)
 
     EXPECT_TRUE(prove_and_verify(ivc));
 };
+
+/**
+ * @brief Fold several circuits into the accumulator per round, exercising each supported batch size
+ * @details Only the first circuit of a batch receives a recursive folding verifier, so the circuits of a batch differ
+ * in size and a structured trace is used. The first fold proof (four instances) is verified recursively in the first
+ * circuit of the second batch; the final fold proof (three instances) is verified natively.
+ *
+ */
+TEST_F(ClientIVCTests, BatchedAccumulation)
+{
+    ClientIVC ivc;
+    ivc.trace_structure = TraceStructure::BATCHED_FOLDING_TEST;
+
+    // Initialize the IVC with an arbitrary circuit
+    Builder circuit_0 = create_mock_circuit(ivc, /*log2_num_gates=*/5);
+    ivc.accumulate(circuit_0);
+
+    // Fold the maximum number of circuits at once, then a smaller batch
+    for (size_t batch_size : { ClientIVC::MAX_BATCH_SIZE, size_t(2) }) {
+        std::vector<Builder> circuits;
+        for (size_t idx = 0; idx < batch_size; ++idx) {
+            circuits.emplace_back(create_mock_circuit(ivc, /*log2_num_gates=*/5 + 3 * idx));
+        }
+        ivc.accumulate_batch(circuits);
+        EXPECT_EQ(ivc.batch_vks.size(), batch_size);
+    }
+
+    EXPECT_TRUE(ivc.prove_and_verify());
+};
+
+/**
+ * @brief Batched accumulation using verification keys precomputed for the same batch size
+ *
+ */
+TEST_F(ClientIVCTests, BatchedPrecomputedVerificationKeys)
+{
+    ClientIVC ivc;
+    ivc.trace_structure = TraceStructure::BATCHED_FOLDING_TEST;
+
+    // Construct a set of arbitrary circuits
+    const size_t NUM_CIRCUITS = 5;
+    const size_t BATCH_SIZE = 2;
+    std::vector<Builder> circuits;
+    for (size_t idx = 0; idx < NUM_CIRCUITS; ++idx) {
+        circuits.emplace_back(create_mock_circuit(ivc, /*log2_num_gates=*/5));
+    }
+
+    // Precompute the verification keys that will be needed for the IVC when accumulating in batches
+    auto precomputed_vkeys = ivc.precompute_folding_verification_keys(circuits, BATCH_SIZE);
+
+    // Initialize the IVC with the first circuit then accumulate the remaining ones in batches
+    ivc.accumulate(circuits[0], precomputed_vkeys[0]);
+    for (size_t start = 1; start < NUM_CIRCUITS; start += BATCH_SIZE) {
+        std::vector<Builder> batch(circuits.begin() + static_cast<std::ptrdiff_t>(start),
+                                   circuits.begin() + static_cast<std::ptrdiff_t>(start + BATCH_SIZE));
+        std::vector<std::shared_ptr<VerificationKey>> batch_vkeys(
+            precomputed_vkeys.begin() + static_cast<std::ptrdiff_t>(start),
+            precomputed_vkeys.begin() + static_cast<std::ptrdiff_t>(start + BATCH_SIZE));
+        ivc.accumulate_batch(batch, batch_vkeys);
+    }
+
+    EXPECT_TRUE(ivc.prove_and_verify());
+};
+
+/**
+ * @brief Precomputing verification keys for a batch size that accumulate_batch does not support is rejected
+ *
+ */
+TEST_F(ClientIVCTests, PrecomputeRejectsInvalidBatchSize)
+{
+    ClientIVC ivc;
+    std::vector<Builder> circuits;
+    circuits.emplace_back(create_mock_circuit(ivc, /*log2_num_gates=*/5));
+
+    EXPECT_ANY_THROW(ivc.precompute_folding_verification_keys(circuits, 0));
+    EXPECT_ANY_THROW(ivc.precompute_folding_verification_keys(circuits, ClientIVC::MAX_BATCH_SIZE + 1));
+};
+
+/**
+ * @brief Batches that are empty, too large to fold at once, or given the wrong number of VKs are rejected before any
+ * circuit is processed
+ *
+ */
+TEST_F(ClientIVCTests, AccumulateBatchRejectsInvalidBatches)
+{
+    ClientIVC ivc;
+    auto make_circuits = [&](size_t num_circuits) {
+        std::vector<Builder> circuits;
+        for (size_t idx = 0; idx < num_circuits; ++idx) {
+            circuits.emplace_back(create_mock_circuit(ivc, /*log2_num_gates=*/5));
+        }
+        return circuits;
+    };
+
+    std::vector<Builder> empty;
+    EXPECT_ANY_THROW(ivc.accumulate_batch(empty));
+
+    // Uninitialized, the first circuit of a batch initializes the accumulator and may be followed by a full batch
+    auto oversized = make_circuits(ClientIVC::MAX_BATCH_SIZE + 2);
+    EXPECT_ANY_THROW(ivc.accumulate_batch(oversized));
+
+    auto circuits = make_circuits(2);
+    std::vector<std::shared_ptr<ClientIVC::VerificationKey>> one_vk(1);
+    EXPECT_ANY_THROW(ivc.accumulate_batch(circuits, one_vk));
+};
+
+/**
+ * @brief Accumulate a set of circuits asynchronously, constructing each circuit while the previous one is being folded
+ *
+ */
+TEST_F(ClientIVCTests, AsyncAccumulation)
+{
+    ClientIVC ivc;
+
+    const size_t NUM_CIRCUITS = 4;
+    std::future<void> accumulated;
+    for (size_t idx = 0; idx < NUM_CIRCUITS; ++idx) {
+        Builder circuit = create_mock_circuit(ivc);
+        accumulated = ivc.accumulate_async(circuit);
+#ifndef NO_MULTITHREADING
+        // The fold is still in flight when control returns, so it overlaps with construction of the next circuit
+        if (idx > 0) {
+            EXPECT_EQ(accumulated.wait_for(std::chrono::seconds(0)), std::future_status::timeout);
+        }
+#endif
+    }
+    accumulated.get();
+
+    EXPECT_TRUE(prove_and_verify(ivc));
+};
@@ -9,16 +9,21 @@
 
 #include "barretenberg/common/op_count.hpp"
 #include "barretenberg/ecc/scalar_multiplication/scalar_multiplication.hpp"
+#include "barretenberg/ecc/scalar_multiplication/signed_digit_msm.hpp"
 #include "barretenberg/numeric/bitop/pow.hpp"
+#include "barretenberg/polynomials/active_range.hpp"
 #include "barretenberg/polynomials/polynomial.hpp"
 #include "barretenberg/polynomials/polynomial_arithmetic.hpp"
 #include "barretenberg/srs/factories/crs_factory.hpp"
 #include "barretenberg/srs/factories/file_crs_factory.hpp"
 #include "barretenberg/srs/global_crs.hpp"
 
+#include <algorithm>
 #include <cstddef>
 #include <memory>
+#include <span>
 #include <string_view>
+#include <vector>
 
 namespace bb {
 
@@ -40,6 +45,10 @@ template <class Curve> class CommitmentKey {
     scalar_multiplication::pippenger_runtime_state<Curve> pippenger_runtime_state;
     std::shared_ptr<srs::factories::CrsFactory<Curve>> crs_factory;
     std::shared_ptr<srs::factories::ProverCrs<Curve>> srs;
+    // MSM engine used by commit and commit_batch
+    scalar_multiplication::MsmEngine msm_engine = scalar_multiplication::MsmEngine::PIPPENGER_WNAF;
+    // Optional fixed-base tables for a prefix of the SRS, see precompute_fixed_base_tables
+    std::shared_ptr<scalar_multiplication::FixedBaseTable<Curve>> fixed_base_table;
 
     CommitmentKey() = delete;
 
@@ -62,8 +71,24 @@ template <class Curve> class CommitmentKey {
         , srs(prover_crs)
     {}
 
+    /**
+     * @brief Opt in to fixed-base MSMs for commitments that only touch the first num_points SRS points
+     * @details Trades memory for speed in long-running provers that commit many times against the same SRS: the tables
+     * cost ceil((128 / window_bits + 1) / stride) times the memory of the point table of the prefix, and with a stride
+     * of 1 a commitment then takes no doublings. The tables can be shared with other keys over the same SRS.
+     */
+    void precompute_fixed_base_tables(size_t num_points, size_t window_bits = 12, size_t stride = 1)
+    {
+        ASSERT(num_points <= srs->get_monomial_size());
+        fixed_base_table = std::make_shared<scalar_multiplication::FixedBaseTable<Curve>>(
+            scalar_multiplication::compute_fixed_base_table<Curve>(
+                srs->get_monomial_points(), num_points, window_bits, stride));
+    }
+
     /**
      * @brief Uses the ProverSRS to create a commitment to p(X)
+     * @details Only the window of coefficients between the first and last non-zero one enters the MSM, so zero rows at
+     * either end of the polynomial (padding, or columns only active on a few rows) cost nothing.
      *
      * @param polynomial a univariate polynomial p(X) = ∑ᵢ aᵢ⋅Xⁱ
      * @return Commitment computed as C = [p(x)] = ∑ᵢ aᵢ⋅Gᵢ
@@ -79,10 +104,109 @@ template <class Curve> class CommitmentKey {
                  srs->get_monomial_size());
             ASSERT(false);
         }
-        return scalar_multiplication::pippenger_unsafe<Curve>(
-            const_cast<Fr*>(polynomial.data()), srs->get_monomial_points(), degree, pippenger_runtime_state);
+        return compute_msm(polynomial.data(), get_active_range(polynomial));
     };
 
+    /**
+     * @brief Commit to several polynomials over the same SRS at once
+     * @details A convenience wrapper that returns the commitments of all inputs together. The inputs are split into
+     * MSM segments: one per polynomial, or, if the polynomials are known to vanish outside of a set of row ranges (e.g.
+     * the blocks of a structured execution trace), one per polynomial and range. Each segment is trimmed to its first
+     * and last non-zero coefficient. Segments too small for pippenger are evaluated as scalar multiplications in one
+     * fan-out; every other segment is an independent MSM through the engine of the key, exactly as commit would run
+     * it. The MSMs do not share a traversal of the points: a fused signed-digit pass with one set of buckets per
+     * polynomial was measured slower than separate MSMs, as the larger bucket sets fall out of cache.
+     *
+     * @param polynomials univariate polynomials p_j(X), each of size at most the SRS size
+     * @param block_ranges if non-empty, row ranges outside of which every p_j is zero
+     * @return The commitments [p_j(x)], in the order of the input
+     */
+    std::vector<Commitment> commit_batch(std::span<const std::span<const Fr>> polynomials,
+                                         std::span<const ActiveRange> block_ranges = {})
+    {
+        BB_OP_COUNT_TIME();
+        using Element = typename Curve::Element;
+
+        const size_t num_polynomials = polynomials.size();
+        for (const auto& polynomial : polynomials) {
+            ASSERT(polynomial.size() <= srs->get_monomial_size());
+        }
+        G1* point_table = srs->get_monomial_points();
+
+        struct Segment {
+            size_t polynomial_idx;
+            ActiveRange range;
+        };
+        std::vector<Segment> segments;
+        for (size_t j = 0; j < num_polynomials; ++j) {
+            const size_t size = polynomials[j].size();
+            if (block_ranges.empty()) {
+                segments.push_back({ j, { 0, size } });
+            }
+            for (const ActiveRange& block : block_ranges) {
+                segments.push_back({ j, { std::min(block.start, size), std::min(block.end, size) } });
+            }
+        }
+        parallel_for(segments.size(), [&](size_t s) {
+            auto& [j, range] = segments[s];
+            const ActiveRange window = get_active_range(polynomials[j].subspan(range.start, range.size()));
+            range = window.empty() ? ActiveRange{}
+                                   : ActiveRange{ range.start + window.start, range.start + window.end };
+        });
+
+        // Same threshold below which pippenger evaluates the MSM as independent scalar multiplications
+        const size_t small_msm_threshold = get_num_cpus_pow2() * 8;
+        std::vector<size_t> small_msm_offsets{ 0 };
+        std::vector<size_t> small_msm_indices;
+        for (size_t s = 0; s < segments.size(); ++s) {
+            const size_t size = segments[s].range.size();
+            if (size > 0 && size <= small_msm_threshold) {
+                small_msm_indices.emplace_back(s);
+                small_msm_offsets.emplace_back(small_msm_offsets.back() + size);
+            }
+        }
+
+        std::vector<Element> results(num_polynomials);
+        for (auto& result : results) {
+            result.self_set_infinity();
+        }
+
+        const size_t num_small_terms = small_msm_offsets.back();
+        std::vector<Element> small_msm_terms(num_small_terms);
+        parallel_for(num_small_terms, [&](size_t i) {
+            // Locate the segment this term belongs to
+            auto next_offset = std::upper_bound(small_msm_offsets.begin(), small_msm_offsets.end(), i);
+            const auto k = static_cast<size_t>(next_offset - small_msm_offsets.begin() - 1);
+            const auto& [j, range] = segments[small_msm_indices[k]];
+            const size_t idx = range.start + (i - small_msm_offsets[k]);
+            small_msm_terms[i] = Element(point_table[idx * 2]) * polynomials[j][idx];
+        });
+        for (size_t k = 0; k < small_msm_indices.size(); ++k) {
+            Element& result = results[segments[small_msm_indices[k]].polynomial_idx];
+            for (size_t i = small_msm_offsets[k]; i < small_msm_offsets[k + 1]; ++i) {
+                result += small_msm_terms[i];
+            }
+        }
+
+        for (const auto& [j, range] : segments) {
+            if (range.size() > small_msm_threshold) {
+                results[j] += compute_msm(polynomials[j].data(), range);
+            }
+        }
+
+        return std::vector<Commitment>(results.begin(), results.end());
+    }
+
+    /**
+     * @brief Commit to a polynomial that vanishes outside of the given row ranges, e.g. a wire of a structured trace
+     * @details Only the populated part of each range enters an MSM, so the zero padding between the fixed-size blocks
+     * of a structured trace costs a scan rather than an MSM.
+     */
+    Commitment commit_structured(std::span<const Fr> polynomial, std::span<const ActiveRange> block_ranges)
+    {
+        return commit_batch(std::span<const std::span<const Fr>>(&polynomial, 1), block_ranges)[0];
+    }
+
     /**
      * @brief Efficiently commit to a sparse polynomial
      * @details Iterate through the {point, scalar} pairs that define the inputs to the commitment MSM, maintain (copy)
@@ -103,16 +227,20 @@ template <class Curve> class CommitmentKey {
         // endomorphism point (\beta*x, -y) at odd indices).
         G1* point_table = srs->get_monomial_points();
 
+        // Only scan the window between the first and last non-zero coefficient
+        const ActiveRange range = get_active_range(polynomial);
+
         // Define structures needed to multithread the extraction of non-zero inputs
-        const size_t num_threads = degree >= get_num_cpus_pow2() ? get_num_cpus_pow2() : 1;
-        const size_t block_size = degree / num_threads;
+        const size_t num_threads = range.size() >= get_num_cpus_pow2() ? get_num_cpus_pow2() : 1;
+        const size_t block_size = range.size() / num_threads;
         std::vector<std::vector<Fr>> thread_scalars(num_threads);
         std::vector<std::vector<G1>> thread_points(num_threads);
 
-        // Loop over all polynomial coefficients and keep {point, scalar} pairs for which scalar != 0
+        // Loop over the polynomial coefficients and keep {point, scalar} pairs for which scalar != 0
         parallel_for(num_threads, [&](size_t thread_idx) {
-            const size_t start = thread_idx * block_size;
-            const size_t end = (thread_idx + 1) * block_size;
+            const size_t start = range.start + thread_idx * block_size;
+            // The last thread also takes the remainder of the window
+            const size_t end = thread_idx == num_threads - 1 ? range.end : start + block_size;
 
             for (size_t idx = start; idx < end; ++idx) {
 
@@ -149,6 +277,24 @@ template <class Curve> class CommitmentKey {
         return scalar_multiplication::pippenger_unsafe<Curve>(
             scalars.data(), points.data(), scalars.size(), pippenger_runtime_state);
     }
+
+  private:
+    /**
+     * @brief Compute ∑_{i ∈ range} scalars[i] ⋅ Gᵢ, from the fixed-base tables if they cover the range
+     */
+    typename Curve::Element compute_msm(const Fr* scalars, const ActiveRange& range)
+    {
+        if (fixed_base_table && range.end <= fixed_base_table->num_points) {
+            return scalar_multiplication::fixed_base_msm<Curve>(
+                scalars + range.start, *fixed_base_table, range.start, range.size());
+        }
+        // The point table holds each SRS point followed by its endomorphism point, hence the factor of 2.
+        return scalar_multiplication::msm<Curve>(const_cast<Fr*>(scalars) + range.start,
+                                                 srs->get_monomial_points() + 2 * range.start,
+                                                 range.size(),
+                                                 pippenger_runtime_state,
+                                                 msm_engine);
+    }
 };
 
 } // namespace bb
@@ -66,4 +66,120 @@ TYPED_TEST(CommitmentKeyTest, CommitSparse)
     EXPECT_EQ(sparse_commit_result, commit_result);
 }
 
+// Check that committing to a polynomial that is zero outside of a window of rows matches the MSM over all rows
+TYPED_TEST(CommitmentKeyTest, CommitActiveRange)
+{
+    using Curve = TypeParam;
+    using CK = CommitmentKey<Curve>;
+    using G1 = Curve::AffineElement;
+    using Fr = Curve::ScalarField;
+    using Polynomial = bb::Polynomial<Fr>;
+
+    const size_t num_points = 1 << 12;
+    const size_t start = 1001;
+    const size_t end = 3017;
+
+    Polynomial poly{ num_points };
+    for (size_t i = start; i < end; ++i) {
+        poly[i] = Fr::random_element();
+    }
+
+    auto key = TestFixture::template create_commitment_key<CK>(num_points);
+    G1 commit_result = key->commit(poly);
+    G1 sparse_commit_result = key->commit_sparse(poly);
+    G1 full_msm_result = scalar_multiplication::pippenger_unsafe<Curve>(
+        poly.begin(), key->srs->get_monomial_points(), num_points, key->pippenger_runtime_state);
+
+    EXPECT_EQ(commit_result, full_msm_result);
+    EXPECT_EQ(sparse_commit_result, full_msm_result);
+}
+
+// Check that commit_batch agrees with commit for a mix of dense, windowed, tiny and zero polynomials
+TYPED_TEST(CommitmentKeyTest, CommitBatch)
+{
+    using Curve = TypeParam;
+    using CK = CommitmentKey<Curve>;
+    using Fr = Curve::ScalarField;
+    using Polynomial = bb::Polynomial<Fr>;
+
+    const size_t num_points = 1 << 12;
+
+    Polynomial dense = Polynomial::random(num_points);
+    Polynomial windowed{ num_points };
+    for (size_t i = 1001; i < 3017; ++i) {
+        windowed[i] = Fr::random_element();
+    }
+    Polynomial tiny{ num_points };
+    tiny[5] = Fr::random_element();
+    tiny[9] = Fr::random_element();
+    Polynomial zero{ num_points };
+    Polynomial short_dense = Polynomial::random(num_points / 4);
+
+    auto key = TestFixture::template create_commitment_key<CK>(num_points);
+    std::vector<std::span<const Fr>> polynomials{ dense, windowed, tiny, zero, short_dense, tiny };
+    auto commitments = key->commit_batch(polynomials);
+
+    ASSERT_EQ(commitments.size(), polynomials.size());
+    for (size_t j = 0; j < polynomials.size(); ++j) {
+        EXPECT_EQ(commitments[j], key->commit(polynomials[j]));
+    }
+}
+
+// Check that committing over the blocks of a structured trace agrees with a plain commitment
+TYPED_TEST(CommitmentKeyTest, CommitStructured)
+{
+    using Curve = TypeParam;
+    using CK = CommitmentKey<Curve>;
+    using Fr = Curve::ScalarField;
+    using Polynomial = bb::Polynomial<Fr>;
+
+    const size_t num_points = 1 << 12;
+
+    // Blocks of various fill levels, separated by zero padding; the last block is empty
+    std::vector<ActiveRange> block_ranges{ { 1, 1025 }, { 1200, 1203 }, { 2048, 3072 }, { 3500, 3600 } };
+    Polynomial poly{ num_points };
+    for (size_t i = 1; i < 700; ++i) {
+        poly[i] = Fr::random_element();
+    }
+    poly[1201] = Fr::random_element();
+    for (size_t i = 2100; i < 3072; ++i) {
+        poly[i] = Fr::random_element();
+    }
+
+    auto key = TestFixture::template create_commitment_key<CK>(num_points);
+    EXPECT_EQ(key->commit_structured(poly, block_ranges), key->commit(poly));
+}
+
+TYPED_TEST(CommitmentKeyTest, CommitWithFixedBaseTables)
+{
+    using Curve = TypeParam;
+    using CK = CommitmentKey<Curve>;
+    using Fr = Curve::ScalarField;
+    using Polynomial = bb::Polynomial<Fr>;
+
+    const size_t num_points = 1 << 12;
+    const size_t num_table_points = 1 << 11;
+
+    Polynomial dense = Polynomial::random(num_table_points);
+    Polynomial windowed{ num_points };
+    for (size_t i = 100; i < 1500; ++i) {
+        windowed[i] = Fr::random_element();
+    }
+    // Reaches past the prefix covered by the tables
+    Polynomial long_dense = Polynomial::random(num_points);
+
+    auto key = TestFixture::template create_commitment_key<CK>(num_points);
+    std::vector<typename Curve::AffineElement> expected;
+    for (const auto* poly : { &dense, &windowed, &long_dense }) {
+        expected.emplace_back(key->commit(*poly));
+    }
+
+    for (size_t stride : std::initializer_list<size_t>{ 1, 3 }) {
+        key->precompute_fixed_base_tables(num_table_points, 10, stride);
+        EXPECT_EQ(key->commit(dense), expected[0]);
+        EXPECT_EQ(key->commit(windowed), expected[1]);
+        EXPECT_EQ(key->commit(long_dense), expected[2]);
+    }
+}
+
 } // namespace bb
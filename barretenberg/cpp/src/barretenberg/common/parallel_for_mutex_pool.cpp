@@ -1,8 +1,10 @@
 #ifndef NO_MULTITHREADING
 #include "log.hpp"
 #include "thread.hpp"
+#include <algorithm>
 #include <atomic>
 #include <condition_variable>
+#include <deque>
 #include <functional>
 #include <mutex>
 #include <queue>
@@ -25,57 +27,60 @@ class ThreadPool {
 
     void start_tasks(size_t num_iterations, const std::function<void(size_t)>& func)
     {
+        if (num_iterations == 0) {
+            return;
+        }
+        // Jobs from different threads (or from a task of another job) are queued rather than run one at a time. The
+        // workers serve them in order of submission, while the calling thread only works on its own job.
+        Job job{ &func, num_iterations };
         {
             std::unique_lock<std::mutex> lock(tasks_mutex);
-            task_ = func;
-            num_iterations_ = num_iterations;
-            iteration_ = 0;
-            complete_ = 0;
+            jobs_.push_back(&job);
         }
         condition.notify_all();
 
-        do_iterations();
+        while (true) {
+            size_t iteration = 0;
+            {
+                std::unique_lock<std::mutex> lock(tasks_mutex);
+                if (job.next_iteration == job.num_iterations) {
+                    break;
+                }
+                iteration = job.next_iteration++;
+                if (job.next_iteration == job.num_iterations) {
+                    jobs_.erase(std::find(jobs_.begin(), jobs_.end(), &job));
+                }
+            }
+            func(iteration);
+            {
+                std::unique_lock<std::mutex> lock(tasks_mutex);
+                ++job.complete;
+            }
+        }
 
         {
             std::unique_lock<std::mutex> lock(tasks_mutex);
-            complete_condition_.wait(lock, [this] { return complete_ == num_iterations_; });
+            complete_condition_.wait(lock, [&job] { return job.complete == job.num_iterations; });
         }
     }
 
   private:
+    struct Job {
+        const std::function<void(size_t)>* task;
+        size_t num_iterations;
+        size_t next_iteration = 0;
+        size_t complete = 0;
+    };
+
     std::vector<std::thread> workers;
     std::mutex tasks_mutex;
-    std::function<void(size_t)> task_;
-    size_t num_iterations_ = 0;
-    size_t iteration_ = 0;
-    size_t complete_ = 0;
+    // Jobs with iterations yet to be started, oldest first. Each lives on the stack of the thread that submitted it.
+    std::deque<Job*> jobs_;
     std::condition_variable condition;
     std::condition_variable complete_condition_;
     bool stop = false;
 
     BB_NO_PROFILE void worker_loop(size_t thread_index);
-
-    void do_iterations()
-    {
-        while (true) {
-            size_t iteration = 0;
-            {
-                std::unique_lock<std::mutex> lock(tasks_mutex);
-                if (iteration_ == num_iterations_) {
-                    return;
-                }
-                iteration = iteration_++;
-            }
-            task_(iteration);
-            {
-                std::unique_lock<std::mutex> lock(tasks_mutex);
-                if (++complete_ == num_iterations_) {
-                    complete_condition_.notify_one();
-                    return;
-                }
-            }
-        }
-    }
 };
 
 ThreadPool::ThreadPool(size_t num_threads)
@@ -102,15 +107,29 @@ void ThreadPool::worker_loop(size_t /*unused*/)
 {
     // info("created worker ", worker_num);
     while (true) {
+        Job* job = nullptr;
+        size_t iteration = 0;
         {
             std::unique_lock<std::mutex> lock(tasks_mutex);
-            condition.wait(lock, [this] { return (iteration_ < num_iterations_) || stop; });
+            condition.wait(lock, [this] { return !jobs_.empty() || stop; });
 
             if (stop) {
                 break;
             }
+            job = jobs_.front();
+            iteration = job->next_iteration++;
+            if (job->next_iteration == job->num_iterations) {
+                jobs_.pop_front();
+            }
+        }
+        (*job->task)(iteration);
+        {
+            std::unique_lock<std::mutex> lock(tasks_mutex);
+            // Several threads may be waiting on their own jobs
+            if (++job->complete == job->num_iterations) {
+                complete_condition_.notify_all();
+            }
         }
-        do_iterations();
     }
     // info("worker exit ", worker_num);
 }
@@ -118,8 +137,9 @@ void ThreadPool::worker_loop(size_t /*unused*/)
 
 namespace bb {
 /**
- * A thread pooled strategy that uses std::mutex for protection. Each worker increments the "iteration" and processes.
- * The main thread acts as a worker also, and when it completes, it spins until thread workers are done.
+ * A thread pooled strategy that uses std::mutex for protection. Each worker increments the "iteration" of the oldest
+ * queued job and processes. The calling thread acts as a worker on its own job also, and when it completes, it waits
+ * until thread workers are done. Concurrent (and nested) calls queue their jobs, so each gets the pool in turn.
  */
 void parallel_for_mutex_pool(size_t num_iterations, const std::function<void(size_t)>& func)
 {
@@ -0,0 +1,414 @@
+#include "thread.hpp"
+#include <atomic>
+#include <functional>
+
+#ifndef NO_MULTITHREADING
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "barretenberg/common/compiler_hints.hpp"
+
+namespace {
+
+struct Task {
+    std::function<void()> func;
+    bb::detail::TaskGroupState* group;
+};
+
+/**
+ * A Chase-Lev work-stealing deque (Le, Pop, Cohen, Zappa Nardelli, "Correct and Efficient Work-Stealing for Weak
+ * Memory Models"). The owning worker pushes and pops at the bottom without taking any lock, thieves take from the top
+ * with a single CAS. The ring buffer grows when full; old buffers are retired (not freed) until the deque is destroyed
+ * since a thief may still be reading from them.
+ */
+class WorkStealingDeque {
+  public:
+    WorkStealingDeque()
+        : buffer_(new RingBuffer(INITIAL_CAPACITY))
+    {}
+    WorkStealingDeque(const WorkStealingDeque& other) = delete;
+    WorkStealingDeque(WorkStealingDeque&& other) = delete;
+    ~WorkStealingDeque() { delete buffer_.load(std::memory_order_relaxed); }
+
+    WorkStealingDeque& operator=(const WorkStealingDeque& other) = delete;
+    WorkStealingDeque& operator=(WorkStealingDeque&& other) = delete;
+
+    // Owner only.
+    void push(Task* task)
+    {
+        const int64_t bottom = bottom_.load(std::memory_order_relaxed);
+        const int64_t top = top_.load(std::memory_order_acquire);
+        RingBuffer* buffer = buffer_.load(std::memory_order_relaxed);
+        if (bottom - top > buffer->capacity - 1) {
+            buffer = grow(buffer, bottom, top);
+        }
+        buffer->put(bottom, task);
+        bottom_.store(bottom + 1, std::memory_order_release);
+    }
+
+    // Owner only.
+    Task* pop()
+    {
+        const int64_t bottom = bottom_.load(std::memory_order_relaxed) - 1;
+        RingBuffer* buffer = buffer_.load(std::memory_order_relaxed);
+        bottom_.store(bottom, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        int64_t top = top_.load(std::memory_order_relaxed);
+        if (top > bottom) {
+            // Deque was empty.
+            bottom_.store(bottom + 1, std::memory_order_relaxed);
+            return nullptr;
+        }
+        Task* task = buffer->get(bottom);
+        if (top == bottom) {
+            // Last element, race against thieves for it.
+            if (!top_.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) {
+                task = nullptr;
+            }
+            bottom_.store(bottom + 1, std::memory_order_relaxed);
+        }
+        return task;
+    }
+
+    // Any thread.
+    Task* steal()
+    {
+        int64_t top = top_.load(std::memory_order_acquire);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        const int64_t bottom = bottom_.load(std::memory_order_acquire);
+        if (top >= bottom) {
+            return nullptr;
+        }
+        RingBuffer* buffer = buffer_.load(std::memory_order_acquire);
+        Task* task = buffer->get(top);
+        if (!top_.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) {
+            return nullptr;
+        }
+        return task;
+    }
+
+  private:
+    static constexpr int64_t INITIAL_CAPACITY = 256;
+
+    struct RingBuffer {
+        explicit RingBuffer(int64_t capacity)
+            : capacity(capacity)
+            , mask(capacity - 1)
+            , slots(new std::atomic<Task*>[static_cast<size_t>(capacity)])
+        {}
+
+        Task* get(int64_t index) const
+        {
+            return slots[static_cast<size_t>(index & mask)].load(std::memory_order_relaxed);
+        }
+        void put(int64_t index, Task* task)
+        {
+            slots[static_cast<size_t>(index & mask)].store(task, std::memory_order_relaxed);
+        }
+
+        int64_t capacity;
+        int64_t mask;
+        std::unique_ptr<std::atomic<Task*>[]> slots;
+    };
+
+    RingBuffer* grow(RingBuffer* old_buffer, int64_t bottom, int64_t top)
+    {
+        auto* new_buffer = new RingBuffer(old_buffer->capacity * 2);
+        for (int64_t i = top; i < bottom; ++i) {
+            new_buffer->put(i, old_buffer->get(i));
+        }
+        retired_buffers_.emplace_back(old_buffer);
+        buffer_.store(new_buffer, std::memory_order_release);
+        return new_buffer;
+    }
+
+    alignas(64) std::atomic<int64_t> top_ = 0;
+    alignas(64) std::atomic<int64_t> bottom_ = 0;
+    std::atomic<RingBuffer*> buffer_;
+    std::vector<std::unique_ptr<RingBuffer>> retired_buffers_;
+};
+
+constexpr size_t NOT_A_WORKER = static_cast<size_t>(-1);
+thread_local size_t worker_index = NOT_A_WORKER;
+
+/**
+ * A pool of workers each owning a WorkStealingDeque. Workers pop their own deque first and otherwise steal from the
+ * others. Threads that are not workers (e.g. the main thread) push onto a small mutex guarded injection queue; this
+ * lock is taken once per task spawned from outside the pool, never per loop iteration, as parallel_for splits ranges
+ * recursively and only the first few splits happen on the calling thread. Idle workers spin briefly and then sleep on
+ * a condition variable until new work is published.
+ */
+class Scheduler {
+  public:
+    Scheduler(size_t num_workers);
+    Scheduler(const Scheduler& other) = delete;
+    Scheduler(Scheduler&& other) = delete;
+    ~Scheduler();
+
+    Scheduler& operator=(const Scheduler& other) = delete;
+    Scheduler& operator=(Scheduler&& other) = delete;
+
+    void submit(Task* task)
+    {
+        if (worker_index != NOT_A_WORKER) {
+            deques_[worker_index]->push(task);
+        } else {
+            std::unique_lock<std::mutex> lock(injection_mutex_);
+            injection_queue_.push_back(task);
+            injection_size_.fetch_add(1, std::memory_order_release);
+        }
+        notify();
+    }
+
+    bool try_run_one()
+    {
+        Task* task = find_task();
+        if (task == nullptr) {
+            return false;
+        }
+        execute(task);
+        return true;
+    }
+
+  private:
+    static constexpr size_t SPIN_ROUNDS = 64;
+
+    std::vector<std::unique_ptr<WorkStealingDeque>> deques_;
+    std::vector<std::thread> workers_;
+    std::mutex injection_mutex_;
+    std::deque<Task*> injection_queue_;
+    std::atomic<size_t> injection_size_ = 0;
+    std::mutex sleep_mutex_;
+    std::condition_variable sleep_condition_;
+    std::atomic<size_t> num_sleeping_ = 0;
+    std::atomic<uint64_t> epoch_ = 0;
+    std::atomic<bool> stop_ = false;
+
+    BB_NO_PROFILE void worker_loop(size_t index);
+
+    static void execute(Task* task)
+    {
+        bb::detail::TaskGroupState* group = task->group;
+#ifndef __wasm__
+        // A task that throws must still complete, or the join of its group would never return. The exception is
+        // rethrown by the join instead.
+        try {
+            task->func();
+        } catch (...) {
+            group->record_exception(std::current_exception());
+        }
+#else
+        task->func();
+#endif
+        // The task group may be destroyed as soon as pending drops to zero, so release the task first.
+        delete task;
+        group->pending.fetch_sub(1, std::memory_order_release);
+    }
+
+    void notify()
+    {
+        epoch_.fetch_add(1, std::memory_order_seq_cst);
+        if (num_sleeping_.load(std::memory_order_seq_cst) > 0) {
+            {
+                std::unique_lock<std::mutex> lock(sleep_mutex_);
+            }
+            sleep_condition_.notify_one();
+        }
+    }
+
+    Task* take_injected()
+    {
+        if (injection_size_.load(std::memory_order_acquire) == 0) {
+            return nullptr;
+        }
+        std::unique_lock<std::mutex> lock(injection_mutex_);
+        if (injection_queue_.empty()) {
+            return nullptr;
+        }
+        Task* task = injection_queue_.front();
+        injection_queue_.pop_front();
+        injection_size_.fetch_sub(1, std::memory_order_relaxed);
+        return task;
+    }
+
+    Task* find_task()
+    {
+        const size_t self = worker_index;
+        if (self != NOT_A_WORKER) {
+            if (Task* task = deques_[self]->pop()) {
+                return task;
+            }
+        }
+        if (Task* task = take_injected()) {
+            return task;
+        }
+        const size_t num_deques = deques_.size();
+        if (num_deques == 0) {
+            return nullptr;
+        }
+        // Start from a pseudo-random victim so that thieves don't all hammer the same deque.
+        thread_local uint64_t rng_state = 0x9e3779b97f4a7c15ULL ^ reinterpret_cast<uintptr_t>(&rng_state);
+        rng_state ^= rng_state << 13;
+        rng_state ^= rng_state >> 7;
+        rng_state ^= rng_state << 17;
+        const size_t start = static_cast<size_t>(rng_state % num_deques);
+        for (size_t i = 0; i < num_deques; ++i) {
+            const size_t victim = (start + i) % num_deques;
+            if (victim == self) {
+                continue;
+            }
+            if (Task* task = deques_[victim]->steal()) {
+                return task;
+            }
+        }
+        return nullptr;
+    }
+};
+
+Scheduler::Scheduler(size_t num_workers)
+{
+    deques_.reserve(num_workers);
+    for (size_t i = 0; i < num_workers; ++i) {
+        deques_.emplace_back(std::make_unique<WorkStealingDeque>());
+    }
+    workers_.reserve(num_workers);
+    for (size_t i = 0; i < num_workers; ++i) {
+        workers_.emplace_back(&Scheduler::worker_loop, this, i);
+    }
+}
+
+Scheduler::~Scheduler()
+{
+    {
+        std::unique_lock<std::mutex> lock(sleep_mutex_);
+        stop_ = true;
+    }
+    sleep_condition_.notify_all();
+    for (auto& worker : workers_) {
+        worker.join();
+    }
+}
+
+void Scheduler::worker_loop(size_t index)
+{
+    worker_index = index;
+    size_t idle_rounds = 0;
+    while (true) {
+        // Read the epoch before looking for work, so a task published after a failed search always wakes us.
+        const uint64_t seen_epoch = epoch_.load(std::memory_order_seq_cst);
+        if (Task* task = find_task()) {
+            execute(task);
+            idle_rounds = 0;
+            continue;
+        }
+        if (stop_.load(std::memory_order_relaxed)) {
+            break;
+        }
+        if (++idle_rounds < SPIN_ROUNDS) {
+            std::this_thread::yield();
+            continue;
+        }
+        num_sleeping_.fetch_add(1, std::memory_order_seq_cst);
+        {
+            std::unique_lock<std::mutex> lock(sleep_mutex_);
+            sleep_condition_.wait(lock, [&] {
+                return stop_.load(std::memory_order_relaxed) || epoch_.load(std::memory_order_seq_cst) != seen_epoch;
+            });
+        }
+        num_sleeping_.fetch_sub(1, std::memory_order_relaxed);
+        idle_rounds = 0;
+    }
+}
+
+Scheduler& get_scheduler()
+{
+    // The calling thread always participates in join, so one fewer worker than cpus.
+    static Scheduler scheduler(bb::get_num_cpus() - 1);
+    return scheduler;
+}
+
+void run_range(bb::TaskGroup& group, size_t start, size_t end, const std::function<void(size_t)>& func)
+{
+    // Keep the upper half of the range available for thieves and descend into the lower half. Thieves end up with
+    // large ranges which they split further on their own deques.
+    while (end - start > 1) {
+        const size_t mid = start + ((end - start) >> 1);
+        bb::spawn(group, [&group, mid, end, &func]() { run_range(group, mid, end, func); });
+        end = mid;
+    }
+    func(start);
+}
+} // namespace
+
+namespace bb {
+void spawn(TaskGroup& group, std::function<void()> task)
+{
+    group.state_.pending.fetch_add(1, std::memory_order_relaxed);
+    get_scheduler().submit(new Task{ std::move(task), &group.state_ });
+}
+
+void join(TaskGroup& group)
+{
+    auto& scheduler = get_scheduler();
+    while (group.state_.pending.load(std::memory_order_acquire) != 0) {
+        if (!scheduler.try_run_one()) {
+            std::this_thread::yield();
+        }
+    }
+    group.state_.rethrow_if_failed();
+}
+
+/**
+ * A work-stealing strategy. The iteration range is split recursively into tasks on the per-thread deques of the
+ * scheduler above, and the calling thread helps execute tasks until all iterations are done. Unlike the pool based
+ * strategies no lock is taken per iteration, and func may itself call parallel_for.
+ */
+void parallel_for_work_stealing(size_t num_iterations, const std::function<void(size_t)>& func)
+{
+    if (num_iterations == 0) {
+        return;
+    }
+    TaskGroup group;
+#ifndef __wasm__
+    try {
+        run_range(group, 0, num_iterations, func);
+    } catch (...) {
+        // The tasks already spawned refer to the group and to func, so must complete before this frame unwinds
+        join(group);
+        throw;
+    }
+#else
+    run_range(group, 0, num_iterations, func);
+#endif
+    join(group);
+}
+} // namespace bb
+#else
+namespace bb {
+void spawn(TaskGroup& group, std::function<void()> task)
+{
+    // The task runs inline, but a failure is still only reported by join, as with the scheduler
+#ifndef __wasm__
+    try {
+        task();
+    } catch (...) {
+        group.state_.record_exception(std::current_exception());
+    }
+#else
+    static_cast<void>(group);
+    task();
+#endif
+}
+
+void join(TaskGroup& group)
+{
+    group.state_.rethrow_if_failed();
+}
+} // namespace bb
+#endif
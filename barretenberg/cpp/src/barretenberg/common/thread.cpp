@@ -34,6 +34,11 @@
  *
  * UPDATE!: Interestingly "atomic_pool" performs worse than "mutex_pool" for some e.g. proving key construction.
  * Haven't done deeper analysis. Defaulting to mutex_pool.
+ *
+ * UPDATE!: mutex_pool takes its mutex twice per iteration, which serialises fine-grained loops. It queues concurrent
+ * and nested jobs, but a nested job's caller only works on that job while it waits. "work_stealing" (build with
+ * -DWORK_STEALING_MULTITHREADING=ON) uses per-thread lock-free deques and supports nesting, as well as the spawn/join
+ * API. Compare the backends with parallel_for_bench before changing the default.
  */
 
 namespace bb {
@@ -69,6 +74,8 @@ void parallel_for_atomic_pool(size_t num_iterations, const std::function<void(si
 
 void parallel_for_mutex_pool(size_t num_iterations, const std::function<void(size_t)>& func);
 
+void parallel_for_work_stealing(size_t num_iterations, const std::function<void(size_t)>& func);
+
 void parallel_for(size_t num_iterations, const std::function<void(size_t)>& func)
 {
 #ifdef NO_MULTITHREADING
@@ -78,6 +85,8 @@ void parallel_for(size_t num_iterations, const std::function<void(size_t)>& func
 #else
 #ifndef NO_OMP_MULTITHREADING
     parallel_for_omp(num_iterations, func);
+#elif defined(WORK_STEALING_MULTITHREADING)
+    parallel_for_work_stealing(num_iterations, func);
 #else
     // parallel_for_spawning(num_iterations, func);
     // parallel_for_moody(num_iterations, func);
@@ -1,9 +1,12 @@
 #pragma once
+#include <algorithm>
 #include <atomic>
 #include <barretenberg/env/hardware_concurrency.hpp>
 #include <barretenberg/numeric/bitop/get_msb.hpp>
+#include <exception>
 #include <functional>
 #include <iostream>
+#include <utility>
 #include <vector>
 
 namespace bb {
@@ -27,6 +30,74 @@ inline size_t get_num_cpus_pow2()
  * The size will be chosen based on the hardware concurrency (i.e., env or cpus)..
  */
 void parallel_for(size_t num_iterations, const std::function<void(size_t)>& func);
+
+class TaskGroup;
+
+/**
+ * @brief Push a task onto the work-stealing scheduler. The task is tracked by `group` until it has run.
+ * @details When called from a scheduler worker the task goes to that worker's own deque (no locking), so tasks may
+ * spawn further tasks and nested parallel regions are supported.
+ */
+void spawn(TaskGroup& group, std::function<void()> task);
+
+/**
+ * @brief Block until every task spawned into `group` has completed. The calling thread executes pending tasks (its own,
+ * or stolen from other workers) while it waits, so joining from inside a task can not deadlock.
+ * @details If any of the tasks threw, the first exception thrown is rethrown once all of them have completed. This
+ * holds under NO_MULTITHREADING too, where spawn runs the task inline.
+ */
+void join(TaskGroup& group);
+
+namespace detail {
+/**
+ * @brief The state of a TaskGroup shared with the scheduler running its tasks
+ */
+struct TaskGroupState {
+    std::atomic<size_t> pending = 0;
+    std::atomic<bool> failed = false;
+    // Written only by the task that set failed, before it stops being pending
+    std::exception_ptr exception;
+
+    void record_exception(std::exception_ptr thrown)
+    {
+        if (!failed.exchange(true, std::memory_order_relaxed)) {
+            exception = std::move(thrown);
+        }
+    }
+
+    // Called by join once every task has completed, leaving the group ready for reuse
+    void rethrow_if_failed()
+    {
+        if (failed.load(std::memory_order_relaxed)) {
+            std::exception_ptr thrown = std::exchange(exception, nullptr);
+            failed.store(false, std::memory_order_relaxed);
+            std::rethrow_exception(thrown);
+        }
+    }
+};
+} // namespace detail
+
+/**
+ * @brief A set of tasks spawned with `spawn` that can be waited on with `join`.
+ * @details Must outlive every task spawned into it, i.e. always `join` before the group goes out of scope.
+ */
+class TaskGroup {
+  public:
+    TaskGroup() = default;
+    TaskGroup(const TaskGroup& other) = delete;
+    TaskGroup(TaskGroup&& other) = delete;
+    ~TaskGroup() = default;
+
+    TaskGroup& operator=(const TaskGroup& other) = delete;
+    TaskGroup& operator=(TaskGroup&& other) = delete;
+
+  private:
+    friend void spawn(TaskGroup& group, std::function<void()> task);
+    friend void join(TaskGroup& group);
+
+    detail::TaskGroupState state_;
+};
+
 void run_loop_in_parallel(size_t num_points,
                           const std::function<void(size_t, size_t)>& func,
                           size_t no_multhreading_if_less_or_equal = 0);
@@ -119,4 +190,47 @@ size_t calculate_num_threads(size_t num_iterations, size_t min_iterations_per_th
 size_t calculate_num_threads_pow2(size_t num_iterations,
                                   size_t min_iterations_per_thread = DEFAULT_MIN_ITERS_PER_THREAD);
 
+/**
+ * @brief Map-reduce over [0, num_iterations) in parallel
+ * @details The range is split into chunks of at least `min_iterations_per_chunk` iterations. Each chunk is mapped with
+ * `map(start, end)` and the partial results are folded with `reduce` in chunk order, so the result does not depend on
+ * how the chunks were scheduled. A few chunks per cpu are used so that the work-stealing backend can balance uneven
+ * chunks.
+ *
+ * @param num_iterations
+ * @param identity Neutral element of `reduce`
+ * @param map Function (size_t start, size_t end) -> T
+ * @param reduce Function (T, T) -> T
+ * @param min_iterations_per_chunk
+ * @return T
+ */
+template <typename T, typename MapFunction, typename ReduceFunction>
+T parallel_reduce(size_t num_iterations,
+                  const T& identity,
+                  const MapFunction& map,
+                  const ReduceFunction& reduce,
+                  size_t min_iterations_per_chunk = DEFAULT_MIN_ITERS_PER_THREAD)
+{
+    constexpr size_t CHUNKS_PER_CPU = 4;
+    size_t num_chunks = std::min(num_iterations / std::max(min_iterations_per_chunk, size_t(1)),
+                                 get_num_cpus() * CHUNKS_PER_CPU);
+    num_chunks = num_chunks > 0 ? num_chunks : 1;
+    const size_t chunk_size = (num_iterations + num_chunks - 1) / num_chunks;
+
+    std::vector<T> partial_results(num_chunks, identity);
+    parallel_for(num_chunks, [&](size_t chunk_index) {
+        const size_t start = std::min(chunk_index * chunk_size, num_iterations);
+        const size_t end = std::min(start + chunk_size, num_iterations);
+        if (start < end) {
+            partial_results[chunk_index] = map(start, end);
+        }
+    });
+
+    T result = identity;
+    for (const auto& partial_result : partial_results) {
+        result = reduce(result, partial_result);
+    }
+    return result;
+}
+
 } // namespace bb
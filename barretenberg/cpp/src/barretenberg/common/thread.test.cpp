@@ -0,0 +1,152 @@
+#include "thread.hpp"
+#include <gtest/gtest.h>
+#include <set>
+#include <stdexcept>
+
+using namespace bb;
+
+#ifndef NO_MULTITHREADING
+namespace bb {
+void parallel_for_work_stealing(size_t num_iterations, const std::function<void(size_t)>& func);
+void parallel_for_mutex_pool(size_t num_iterations, const std::function<void(size_t)>& func);
+} // namespace bb
+
+TEST(thread, WorkStealingVisitsEveryIterationOnce)
+{
+    constexpr size_t num_iterations = 10000;
+    std::vector<std::atomic<size_t>> counts(num_iterations);
+    parallel_for_work_stealing(num_iterations, [&](size_t i) { counts[i]++; });
+    for (auto& count : counts) {
+        EXPECT_EQ(count, 1U);
+    }
+}
+
+TEST(thread, WorkStealingNested)
+{
+    constexpr size_t num_outer = 64;
+    constexpr size_t num_inner = 37;
+    std::vector<std::atomic<size_t>> counts(num_outer);
+    parallel_for_work_stealing(num_outer, [&](size_t i) {
+        parallel_for_work_stealing(num_inner, [&](size_t) { counts[i]++; });
+    });
+    for (auto& count : counts) {
+        EXPECT_EQ(count, num_inner);
+    }
+}
+
+TEST(thread, WorkStealingPropagatesExceptions)
+{
+    constexpr size_t num_iterations = 1000;
+    std::atomic<size_t> count = 0;
+    auto run = [&](size_t throwing_iteration) {
+        parallel_for_work_stealing(num_iterations, [&](size_t i) {
+            count++;
+            if (i == throwing_iteration) {
+                throw std::runtime_error("iteration failed");
+            }
+        });
+    };
+    // Thrown on the calling thread, and from a task
+    EXPECT_THROW(run(0), std::runtime_error);
+    EXPECT_THROW(run(num_iterations - 1), std::runtime_error);
+    // Every other iteration still ran, and the scheduler is still usable
+    EXPECT_EQ(count, 2 * num_iterations);
+    count = 0;
+    parallel_for_work_stealing(num_iterations, [&](size_t) { count++; });
+    EXPECT_EQ(count, num_iterations);
+}
+
+TEST(thread, MutexPoolNested)
+{
+    constexpr size_t num_outer = 16;
+    constexpr size_t num_inner = 37;
+    std::vector<std::atomic<size_t>> counts(num_outer);
+    parallel_for_mutex_pool(num_outer, [&](size_t i) {
+        parallel_for_mutex_pool(num_inner, [&](size_t) { counts[i]++; });
+    });
+    for (auto& count : counts) {
+        EXPECT_EQ(count, num_inner);
+    }
+}
+
+// A job submitted while another thread's job is in flight must be spread over the pool, not run on one thread
+TEST(thread, MutexPoolServesConcurrentJobs)
+{
+    constexpr size_t num_iterations = 64;
+    std::atomic<bool> first_job_started = false;
+    std::atomic<bool> second_job_done = false;
+    std::mutex thread_ids_mutex;
+    std::set<std::thread::id> thread_ids;
+    std::thread other([&] {
+        while (!first_job_started) {
+            std::this_thread::yield();
+        }
+        parallel_for_mutex_pool(num_iterations, [&](size_t) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            std::lock_guard<std::mutex> lock(thread_ids_mutex);
+            thread_ids.insert(std::this_thread::get_id());
+        });
+        second_job_done = true;
+    });
+    // Occupies the pool until the other thread's job is complete
+    parallel_for_mutex_pool(1, [&](size_t) {
+        first_job_started = true;
+        while (!second_job_done) {
+            std::this_thread::yield();
+        }
+    });
+    other.join();
+    EXPECT_EQ(thread_ids.size() > 1, get_num_cpus() > 1);
+}
+#endif
+
+TEST(thread, SpawnJoin)
+{
+    constexpr size_t num_tasks = 1000;
+    std::atomic<size_t> count = 0;
+    TaskGroup group;
+    for (size_t i = 0; i < num_tasks; ++i) {
+        spawn(group, [&]() {
+            // Tasks spawning and joining their own groups.
+            TaskGroup inner_group;
+            spawn(inner_group, [&]() { count++; });
+            join(inner_group);
+        });
+    }
+    join(group);
+    EXPECT_EQ(count, num_tasks);
+}
+
+// A task's exception surfaces at join, whether the task ran on a worker or inline under NO_MULTITHREADING
+TEST(thread, SpawnRethrowsAtJoin)
+{
+    std::atomic<size_t> count = 0;
+    TaskGroup group;
+    EXPECT_NO_THROW(spawn(group, []() { throw std::runtime_error("task failed"); }));
+    spawn(group, [&]() { count++; });
+    EXPECT_THROW(join(group), std::runtime_error);
+    EXPECT_EQ(count, 1);
+
+    // The group can be reused once joined
+    spawn(group, [&]() { count++; });
+    EXPECT_NO_THROW(join(group));
+    EXPECT_EQ(count, 2);
+}
+
+TEST(thread, ParallelReduce)
+{
+    constexpr size_t num_iterations = 100003;
+    auto sum_range = [](size_t start, size_t end) {
+        size_t sum = 0;
+        for (size_t i = start; i < end; ++i) {
+            sum += i;
+        }
+        return sum;
+    };
+    size_t result = parallel_reduce(num_iterations, size_t(0), sum_range, std::plus<>());
+    EXPECT_EQ(result, num_iterations * (num_iterations - 1) / 2);
+
+    // Fewer iterations than the minimum chunk size.
+    EXPECT_EQ(parallel_reduce(3, size_t(0), sum_range, std::plus<>()), 3U);
+    EXPECT_EQ(parallel_reduce(0, size_t(0), sum_range, std::plus<>()), 0U);
+}
@@ -1,5 +1,9 @@
 #pragma once
+#include "../../../common/thread.hpp"
 #include "../hash_path.hpp"
+#include <algorithm>
+#include <concepts>
+#include <span>
 
 namespace bb::crypto::merkle_tree {
 
@@ -7,9 +11,20 @@ using namespace bb;
 
 typedef uint256_t index_t;
 
+/**
+ * @brief A store holding nodes as field elements (e.g. ArrayStore), which the tree reads and writes without serialising
+ * them. Stores of serialised nodes (e.g. PersistentStore) are supported too.
+ */
+template <typename Store>
+concept FieldNodeStore = requires(Store& store, const fr& value, fr& out) {
+    store.put(size_t(), size_t(), value);
+    { store.get(size_t(), size_t(), out) } -> std::same_as<bool>;
+};
+
 /**
  * @brief Implements a simple append-only merkle tree
- * Accepts template argument of the type of store backing the tree and the hashing policy
+ * Accepts template argument of the type of store backing the tree and the hashing policy. If the store reports the
+ * number of leaves it holds (leaf_count), the tree resumes from the nodes in it.
  *
  */
 template <typename Store, typename HashingPolicy> class AppendOnlyTree {
@@ -49,6 +64,18 @@ template <typename Store, typename HashingPolicy> class AppendOnlyTree {
      */
     fr_hash_path get_hash_path(const index_t& index) const;
 
+    /**
+     * @brief Writes the hash path from the leaf at the given index to the root into path, reusing its memory
+     */
+    void get_hash_path(const index_t& index, fr_hash_path& path) const;
+
+    /**
+     * @brief Returns the hash paths from the leaves at the given indices to the root
+     * @details Nodes shared between paths are read once, each level reading its distinct nodes in index order and in
+     * parallel.
+     */
+    fr_hash_paths get_hash_paths(std::span<const index_t> indices) const;
+
   protected:
     fr get_element_or_zero(size_t level, const index_t& index) const;
 
@@ -79,6 +106,14 @@ AppendOnlyTree<Store, HashingPolicy>::AppendOnlyTree(Store& store, size_t depth,
     }
     zero_hashes_[0] = current;
     root_ = current;
+
+    // Resume from the nodes already held by a persistent store (see PersistentStore)
+    if constexpr (requires { store.leaf_count(); }) {
+        size_ = store.leaf_count();
+        if (size_ > 0) {
+            root_ = read_node(0, 0).second;
+        }
+    }
 }
 
 template <typename Store, typename HashingPolicy> AppendOnlyTree<Store, HashingPolicy>::~AppendOnlyTree() {}
@@ -102,6 +137,15 @@ template <typename Store, typename HashingPolicy>
 fr_hash_path AppendOnlyTree<Store, HashingPolicy>::get_hash_path(const index_t& index) const
 {
     fr_hash_path path;
+    path.reserve(depth_);
+    get_hash_path(index, path);
+    return path;
+}
+
+template <typename Store, typename HashingPolicy>
+void AppendOnlyTree<Store, HashingPolicy>::get_hash_path(const index_t& index, fr_hash_path& path) const
+{
+    path.clear();
     index_t current_index = index;
 
     for (size_t level = depth_; level > 0; --level) {
@@ -113,7 +157,71 @@ fr_hash_path AppendOnlyTree<Store, HashingPolicy>::get_hash_path(const index_t&
         path.push_back(std::make_pair(left_value, right_value));
         current_index >>= 1;
     }
-    return path;
+}
+
+template <typename Store, typename HashingPolicy>
+fr_hash_paths AppendOnlyTree<Store, HashingPolicy>::get_hash_paths(std::span<const index_t> indices) const
+{
+    constexpr size_t MIN_ITERATIONS_PER_THREAD = 16;
+
+    // The distinct nodes on the paths at the current level, in increasing order. As the parents of ordered nodes are
+    // ordered, the leaves only need sorting once.
+    std::vector<size_t> nodes(indices.size());
+    for (size_t i = 0; i < indices.size(); ++i) {
+        nodes[i] = size_t(indices[i]);
+    }
+    std::sort(nodes.begin(), nodes.end());
+    nodes.erase(std::unique(nodes.begin(), nodes.end()), nodes.end());
+    std::vector<size_t> leaf_positions(indices.size());
+    for (size_t i = 0; i < indices.size(); ++i) {
+        leaf_positions[i] = size_t(std::lower_bound(nodes.begin(), nodes.end(), size_t(indices[i])) - nodes.begin());
+    }
+
+    // For each level from the leaves up: the siblings below each distinct parent, and the position of the parent of
+    // each distinct node of the level below among them
+    std::vector<std::vector<std::pair<fr, fr>>> siblings(depth_);
+    std::vector<std::vector<size_t>> parent_positions(depth_);
+    for (size_t level = depth_; level > 0; --level) {
+        const size_t path_position = depth_ - level;
+        auto& level_parent_positions = parent_positions[path_position];
+        level_parent_positions.resize(nodes.size());
+        size_t num_parents = 0;
+        for (size_t j = 0; j < nodes.size(); ++j) {
+            const size_t parent = nodes[j] >> 1;
+            if (num_parents == 0 || nodes[num_parents - 1] != parent) {
+                nodes[num_parents++] = parent;
+            }
+            level_parent_positions[j] = num_parents - 1;
+        }
+        nodes.resize(num_parents);
+
+        auto& level_siblings = siblings[path_position];
+        level_siblings.resize(nodes.size());
+        run_loop_in_parallel(
+            nodes.size(),
+            [&](size_t start, size_t end) {
+                for (size_t j = start; j < end; ++j) {
+                    level_siblings[j] = std::make_pair(get_element_or_zero(level, nodes[j] * 2),
+                                                       get_element_or_zero(level, nodes[j] * 2 + 1));
+                }
+            },
+            MIN_ITERATIONS_PER_THREAD);
+    }
+
+    fr_hash_paths paths{ .depth = depth_, .nodes = std::vector<std::pair<fr, fr>>(indices.size() * depth_) };
+    run_loop_in_parallel(
+        indices.size(),
+        [&](size_t start, size_t end) {
+            for (size_t i = start; i < end; ++i) {
+                size_t position = leaf_positions[i];
+                for (size_t j = 0; j < depth_; ++j) {
+                    position = parent_positions[j][position];
+                    paths.nodes[i * depth_ + j] = siblings[j][position];
+                }
+            }
+        },
+        MIN_ITERATIONS_PER_THREAD);
+    return paths;
 }
 
 template <typename Store, typename HashingPolicy> fr AppendOnlyTree<Store, HashingPolicy>::add_value(const fr& value)
@@ -124,40 +232,45 @@ template <typename Store, typename HashingPolicy> fr AppendOnlyTree<Store, Hashi
 template <typename Store, typename HashingPolicy>
 fr AppendOnlyTree<Store, HashingPolicy>::add_values(const std::vector<fr>& values)
 {
-    index_t index = size();
-    size_t number_to_insert = values.size();
-    size_t level = depth_;
-    std::vector<fr> hashes = values;
-
-    // Add the values at the leaf nodes of the tree
-    for (size_t i = 0; i < number_to_insert; ++i) {
-        write_node(level, index + i, hashes[i]);
+    if (values.empty()) {
+        return root_;
     }
 
-    // Hash the values as a sub tree and insert them
-    while (number_to_insert > 1) {
-        number_to_insert >>= 1;
-        index >>= 1;
-        --level;
-        for (size_t i = 0; i < number_to_insert; ++i) {
-            hashes[i] = HashingPolicy::hash_pair(hashes[i * 2], hashes[i * 2 + 1]);
-            write_node(level, index + i, hashes[i]);
-        }
+    // The nodes of the current level that are changed by the insertion span [start, end); they are all known, bar the
+    // left sibling of an unaligned start, which is read from the store. Everything to the right of the inserted leaves
+    // is empty, so the right sibling of an unaligned end is the zero hash of its level.
+    size_t start = size_t(size_);
+    size_t end = start + values.size();
+    size_t level = depth_;
+    std::vector<fr> hashes = values;
+    for (size_t i = 0; i < hashes.size(); ++i) {
+        write_node(level, start + i, hashes[i]);
     }
 
-    // Hash from the root of the sub-tree to the root of the overall tree
-    fr new_hash = hashes[0];
+    // Hash a level at a time, each level in one parallel batch
+    std::vector<fr> left((hashes.size() + 3) / 2);
+    std::vector<fr> right((hashes.size() + 3) / 2);
     while (level > 0) {
-        bool is_right = bool(index & 0x01);
-        fr left_hash = is_right ? get_element_or_zero(level, index - 1) : new_hash;
-        fr right_hash = is_right ? new_hash : get_element_or_zero(level, index + 1);
-        new_hash = HashingPolicy::hash_pair(left_hash, right_hash);
-        index >>= 1;
+        const size_t parent_start = start >> 1;
+        const size_t parent_end = ((end - 1) >> 1) + 1;
+        const size_t num_parents = parent_end - parent_start;
+        for (size_t i = 0; i < num_parents; ++i) {
+            const size_t left_index = (parent_start + i) * 2;
+            left[i] = left_index >= start ? hashes[left_index - start] : get_element_or_zero(level, left_index);
+            right[i] = left_index + 1 < end ? hashes[left_index + 1 - start] : zero_hashes_[level];
+        }
+        HashingPolicy::hash_pairs(std::span(left).first(num_parents),
+                                  std::span(right).first(num_parents),
+                                  std::span(hashes).first(num_parents));
         --level;
-        write_node(level, index, new_hash);
+        for (size_t i = 0; i < num_parents; ++i) {
+            write_node(level, parent_start + i, hashes[i]);
+        }
+        start = parent_start;
+        end = parent_end;
     }
     size_ += values.size();
-    root_ = new_hash;
+    root_ = hashes[0];
     return root_;
 }
 
@@ -175,21 +288,33 @@ fr AppendOnlyTree<Store, HashingPolicy>::get_element_or_zero(size_t level, const
 template <typename Store, typename HashingPolicy>
 void AppendOnlyTree<Store, HashingPolicy>::write_node(size_t level, const index_t& index, const fr& value)
 {
-    std::vector<uint8_t> buf;
-    write(buf, value);
-    store_.put(level, size_t(index), buf);
+    if constexpr (FieldNodeStore<Store>) {
+        store_.put(level, size_t(index), value);
+    } else {
+        std::vector<uint8_t> buf;
+        write(buf, value);
+        store_.put(level, size_t(index), buf);
+    }
 }
 
 template <typename Store, typename HashingPolicy>
 std::pair<bool, fr> AppendOnlyTree<Store, HashingPolicy>::read_node(size_t level, const index_t& index) const
 {
-    std::vector<uint8_t> buf;
-    bool available = store_.get(level, size_t(index), buf);
-    if (!available) {
-        return std::make_pair(false, fr::zero());
+    if constexpr (FieldNodeStore<Store>) {
+        fr value;
+        if (!store_.get(level, size_t(index), value)) {
+            return std::make_pair(false, fr::zero());
+        }
+        return std::make_pair(true, value);
+    } else {
+        std::vector<uint8_t> buf;
+        bool available = store_.get(level, size_t(index), buf);
+        if (!available) {
+            return std::make_pair(false, fr::zero());
+        }
+        fr value = from_buffer<fr>(buf, 0);
+        return std::make_pair(true, value);
     }
-    fr value = from_buffer<fr>(buf, 0);
-    return std::make_pair(true, value);
 }
 
 } // namespace bb::crypto::merkle_tree
\ No newline at end of file
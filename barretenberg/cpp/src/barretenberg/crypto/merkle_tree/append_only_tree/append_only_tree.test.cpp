@@ -125,3 +125,64 @@ TEST(stdlib_append_only_tree, can_be_filled)
     EXPECT_EQ(tree.get_hash_path(0), memdb.get_hash_path(0));
     EXPECT_EQ(tree.get_hash_path(7), memdb.get_hash_path(7));
 }
+
+TEST(stdlib_append_only_tree, can_add_unaligned_batches)
+{
+    constexpr size_t depth = 10;
+    ArrayStore store(depth);
+    AppendOnlyTree<ArrayStore, Poseidon2HashPolicy> tree(store, depth);
+    MemoryTree<Poseidon2HashPolicy> memdb(depth);
+
+    // Batches of sizes that are not powers of two, starting at indices that are not multiples of their size
+    size_t index = 0;
+    for (size_t batch_size : std::initializer_list<size_t>{ 1, 3, 2, 7, 12, 5, 33, 1, 64, 100 }) {
+        std::vector<fr> batch(VALUES.begin() + static_cast<std::ptrdiff_t>(index),
+                              VALUES.begin() + static_cast<std::ptrdiff_t>(index + batch_size));
+        for (size_t i = 0; i < batch_size; ++i) {
+            memdb.update_element(index + i, batch[i]);
+        }
+        EXPECT_EQ(tree.add_values(batch), memdb.root());
+        index += batch_size;
+
+        EXPECT_EQ(tree.size(), index);
+        EXPECT_EQ(tree.get_hash_path(index - 1), memdb.get_hash_path(index - 1));
+        EXPECT_EQ(tree.get_hash_path(index), memdb.get_hash_path(index));
+    }
+}
+
+TEST(stdlib_append_only_tree, can_reuse_hash_path_buffer)
+{
+    constexpr size_t depth = 10;
+    ArrayStore store(depth);
+    AppendOnlyTree<ArrayStore, Poseidon2HashPolicy> tree(store, depth);
+    MemoryTree<Poseidon2HashPolicy> memdb(depth);
+
+    for (size_t i = 0; i < 64; i++) {
+        memdb.update_element(i, VALUES[i]);
+    }
+    tree.add_values(std::vector<fr>(VALUES.begin(), VALUES.begin() + 64));
+
+    fr_hash_path path;
+    for (size_t i = 0; i < 128; i += 7) {
+        tree.get_hash_path(i, path);
+        EXPECT_EQ(path, memdb.get_hash_path(i));
+    }
+}
+
+TEST(stdlib_append_only_tree, can_get_multiple_hash_paths)
+{
+    constexpr size_t depth = 10;
+    ArrayStore store(depth);
+    AppendOnlyTree<ArrayStore, Poseidon2HashPolicy> tree(store, depth);
+    tree.add_values(std::vector<fr>(VALUES.begin(), VALUES.begin() + 100));
+
+    // Unordered, with duplicates, siblings and empty leaves
+    const std::vector<index_t> indices{ 5, 99, 0, 5, 64, 4, 100, 1023, 37, 36, 512 };
+    const fr_hash_paths paths = tree.get_hash_paths(indices);
+
+    EXPECT_EQ(paths.size(), indices.size());
+    for (size_t i = 0; i < indices.size(); ++i) {
+        const fr_hash_path expected = tree.get_hash_path(indices[i]);
+        EXPECT_EQ(fr_hash_path(paths[i].begin(), paths[i].end()), expected);
+    }
+}
@@ -1,37 +1,56 @@
 #pragma once
 #include "barretenberg/stdlib/primitives/field/field.hpp"
+#include <atomic>
+#include <memory>
 
 namespace bb::crypto::merkle_tree {
 
 /**
  * @brief A very basic 2-d array for use as a backing store for merkle trees.
  * Can store up to 'indices' nodes per row and 'levels' rows.
+ * @details Nodes are held as field elements in a contiguous array per level, alongside a bitmap of the slots written,
+ * so reading and writing them does not allocate. A level is never larger than the number of nodes it can hold, and
+ * its slots are left uninitialised until written, so only the memory of the nodes written is ever touched. Nodes at
+ * distinct indices may be written concurrently.
  */
 class ArrayStore {
 
   public:
     ArrayStore(size_t levels, size_t indices = 1024)
-        : map_(std::vector<std::vector<std::pair<bool, std::vector<uint8_t>>>>(
-              levels + 1,
-              std::vector<std::pair<bool, std::vector<uint8_t>>>(
-                  indices, std::pair<bool, std::vector<uint8_t>>(false, std::vector<uint8_t>()))))
-    {}
+    {
+        levels_.reserve(levels + 1);
+        for (size_t level = 0; level <= levels; ++level) {
+            levels_.emplace_back(level < 64 ? std::min(indices, size_t(1) << level) : indices);
+        }
+    }
     ~ArrayStore() {}
 
-    void put(size_t level, size_t index, const std::vector<uint8_t>& data)
+    void put(size_t level, size_t index, const fr& value)
     {
-        map_[level][index] = std::make_pair(true, data);
+        Level& row = levels_[level];
+        row.nodes[index] = value;
+        row.present[index / 64].fetch_or(uint64_t(1) << (index % 64), std::memory_order_relaxed);
     }
-    bool get(size_t level, size_t index, std::vector<uint8_t>& data) const
+    bool get(size_t level, size_t index, fr& value) const
     {
-        const std::pair<bool, std::vector<uint8_t>>& slot = map_[level][index];
-        if (slot.first) {
-            data = slot.second;
+        const Level& row = levels_[level];
+        const bool present = (row.present[index / 64].load(std::memory_order_relaxed) >> (index % 64)) & 1;
+        if (present) {
+            value = row.nodes[index];
         }
-        return slot.first;
+        return present;
     }
 
   private:
-    std::vector<std::vector<std::pair<bool, std::vector<uint8_t>>>> map_;
+    struct Level {
+        explicit Level(size_t size)
+            : nodes(new fr[size])
+            , present((size + 63) / 64)
+        {}
+        std::unique_ptr<fr[]> nodes;
+        std::vector<std::atomic<uint64_t>> present;
+    };
+
+    std::vector<Level> levels_;
 };
-} // namespace bb::crypto::merkle_tree
\ No newline at end of file
+} // namespace bb::crypto::merkle_tree
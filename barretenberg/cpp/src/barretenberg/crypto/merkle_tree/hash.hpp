@@ -1,5 +1,7 @@
 #pragma once
 #include "barretenberg/common/net.hpp"
+#include "barretenberg/common/thread.hpp"
+#include "barretenberg/common/throw_or_abort.hpp"
 #include "barretenberg/crypto/blake2s/blake2s.hpp"
 #include "barretenberg/crypto/pedersen_commitment/pedersen.hpp"
 #include "barretenberg/crypto/pedersen_hash/pedersen.hpp"
@@ -8,6 +10,7 @@
 #include "barretenberg/stdlib/hash/blake2s/blake2s.hpp"
 #include "barretenberg/stdlib/hash/pedersen/pedersen.hpp"
 #include "barretenberg/stdlib/primitives/field/field.hpp"
+#include <span>
 #include <vector>
 
 namespace bb::crypto::merkle_tree {
@@ -17,6 +20,19 @@ struct PedersenHashPolicy {
 
     static fr hash_pair(const fr& lhs, const fr& rhs) { return hash(std::vector<fr>({ lhs, rhs })); }
 
+    /**
+     * @brief Computes out[i] = hash_pair(left[i], right[i]) for all i, in parallel
+     */
+    static void hash_pairs(std::span<const fr> left, std::span<const fr> right, std::span<fr> out)
+    {
+        ASSERT(left.size() == out.size() && right.size() == out.size());
+        run_loop_in_parallel(out.size(), [&](size_t start, size_t end) {
+            for (size_t i = start; i < end; ++i) {
+                out[i] = hash_pair(left[i], right[i]);
+            }
+        });
+    }
+
     static fr zero_hash() { return fr::zero(); }
 };
 
@@ -26,7 +42,19 @@ struct Poseidon2HashPolicy {
         return bb::crypto::Poseidon2<bb::crypto::Poseidon2Bn254ScalarFieldParams>::hash(inputs);
     }
 
-    static fr hash_pair(const fr& lhs, const fr& rhs) { return hash(std::vector<fr>({ lhs, rhs })); }
+    static fr hash_pair(const fr& lhs, const fr& rhs)
+    {
+        const std::array<fr, 2> inputs{ lhs, rhs };
+        return bb::crypto::Poseidon2<bb::crypto::Poseidon2Bn254ScalarFieldParams>::Sponge::hash_fixed_length(inputs);
+    }
+
+    /**
+     * @brief Computes out[i] = hash_pair(left[i], right[i]) for all i, in parallel and several pairs at a time
+     */
+    static void hash_pairs(std::span<const fr> left, std::span<const fr> right, std::span<fr> out)
+    {
+        bb::crypto::Poseidon2<bb::crypto::Poseidon2Bn254ScalarFieldParams>::hash_pairs(left, right, out);
+    }
 
     static fr zero_hash() { return fr::zero(); }
 };
@@ -42,46 +70,47 @@ inline bb::fr hash_native(std::vector<bb::fr> const& inputs)
 }
 
 /**
- * Computes the root of a tree with leaves given as the vector `input`.
+ * Computes the nodes of a tree with leaves given as the vector `input`, level by level from the leaves up to the root,
+ * which is last.
  *
- * @param input: vector of leaf values.
- * @returns root as field
+ * @param input: vector of leaf values, of non-zero power of two size.
+ * @returns all nodes of the tree
  */
-inline bb::fr compute_tree_root_native(std::vector<bb::fr> const& input)
+inline std::vector<bb::fr> compute_tree_native(std::vector<bb::fr> const& input)
 {
-    // Check if the input vector size is a power of 2.
-    ASSERT(input.size() > 0);
-    ASSERT(numeric::is_power_of_two(input.size()));
-    auto layer = input;
-    while (layer.size() > 1) {
-        std::vector<bb::fr> next_layer(layer.size() / 2);
-        for (size_t i = 0; i < next_layer.size(); ++i) {
-            next_layer[i] = crypto::pedersen_hash::hash({ layer[i * 2], layer[i * 2 + 1] });
+    // Every level must pair up exactly, or trailing nodes would not be committed to by the root
+    if (input.empty() || !numeric::is_power_of_two(input.size())) {
+        throw_or_abort("compute_tree_native: number of leaves must be a non-zero power of two");
+    }
+    // The tree is laid out level by level from the leaves, so each level is hashed in one batch from the previous one
+    std::vector<bb::fr> tree(2 * input.size() - 1);
+    std::copy(input.begin(), input.end(), tree.begin());
+    std::vector<bb::fr> left(input.size() / 2);
+    std::vector<bb::fr> right(input.size() / 2);
+    size_t layer_start = 0;
+    for (size_t layer_size = input.size(); layer_size > 1; layer_size /= 2) {
+        const size_t next_layer_size = layer_size / 2;
+        for (size_t i = 0; i < next_layer_size; ++i) {
+            left[i] = tree[layer_start + i * 2];
+            right[i] = tree[layer_start + i * 2 + 1];
         }
-        layer = std::move(next_layer);
+        PedersenHashPolicy::hash_pairs(std::span(left).first(next_layer_size),
+                                       std::span(right).first(next_layer_size),
+                                       std::span(tree).subspan(layer_start + layer_size, next_layer_size));
+        layer_start += layer_size;
     }
-
-    return layer[0];
+    return tree;
 }
 
-// TODO write test
-inline std::vector<bb::fr> compute_tree_native(std::vector<bb::fr> const& input)
+/**
+ * Computes the root of a tree with leaves given as the vector `input`.
+ *
+ * @param input: vector of leaf values, of non-zero power of two size.
+ * @returns root as field
+ */
+inline bb::fr compute_tree_root_native(std::vector<bb::fr> const& input)
 {
-    // Check if the input vector size is a power of 2.
-    ASSERT(input.size() > 0);
-    ASSERT(numeric::is_power_of_two(input.size()));
-    auto layer = input;
-    std::vector<bb::fr> tree(input);
-    while (layer.size() > 1) {
-        std::vector<bb::fr> next_layer(layer.size() / 2);
-        for (size_t i = 0; i < next_layer.size(); ++i) {
-            next_layer[i] = crypto::pedersen_hash::hash({ layer[i * 2], layer[i * 2 + 1] });
-            tree.push_back(next_layer[i]);
-        }
-        layer = std::move(next_layer);
-    }
-
-    return tree;
+    return compute_tree_native(input).back();
 }
 
 } // namespace bb::crypto::merkle_tree
@@ -62,3 +62,37 @@ TEST(crypto_merkle_tree_hash, compute_tree_native)
     }
     EXPECT_EQ(tree_vector.back(), mem_tree.root());
 }
+
+TEST(crypto_merkle_tree_hash, compute_tree_root_native_covers_every_leaf)
+{
+    constexpr size_t depth = 3;
+    merkle_tree::MemoryTree<merkle_tree::PedersenHashPolicy> mem_tree(depth);
+    std::vector<fr> leaves(size_t(1) << depth);
+    for (size_t i = 0; i < leaves.size(); i++) {
+        leaves[i] = fr::random_element();
+        mem_tree.update_element(i, leaves[i]);
+    }
+    const fr root = merkle_tree::compute_tree_root_native(leaves);
+    EXPECT_EQ(root, mem_tree.root());
+
+    // Changing any single leaf changes the root
+    for (size_t i = 0; i < leaves.size(); i++) {
+        auto modified = leaves;
+        modified[i] += fr::one();
+        EXPECT_NE(merkle_tree::compute_tree_root_native(modified), root);
+    }
+}
+
+TEST(crypto_merkle_tree_hash, compute_tree_native_rejects_non_power_of_two)
+{
+    std::vector<fr> leaves(6);
+    for (auto& leaf : leaves) {
+        leaf = fr::random_element();
+    }
+    EXPECT_ANY_THROW(merkle_tree::compute_tree_native(leaves));
+    EXPECT_ANY_THROW(merkle_tree::compute_tree_root_native(leaves));
+    EXPECT_ANY_THROW(merkle_tree::compute_tree_native({}));
+    EXPECT_ANY_THROW(merkle_tree::compute_tree_root_native({}));
+
+    EXPECT_EQ(merkle_tree::compute_tree_root_native({ leaves[0] }), leaves[0]);
+}
@@ -2,12 +2,28 @@
 #include "barretenberg/stdlib/primitives/field/field.hpp"
 #include "hash.hpp"
 #include <algorithm>
+#include <span>
 #include <vector>
 
 namespace bb::crypto::merkle_tree {
 
 using fr_hash_path = std::vector<std::pair<fr, fr>>;
 using fr_sibling_path = std::vector<fr>;
+
+/**
+ * @brief The hash paths of several leaves in one contiguous buffer, the path of the i-th leaf taking the depth entries
+ * from i * depth, ordered from the leaf up as in fr_hash_path
+ */
+struct fr_hash_paths {
+    size_t depth = 0;
+    std::vector<std::pair<fr, fr>> nodes;
+
+    size_t size() const { return depth == 0 ? 0 : nodes.size() / depth; }
+    std::span<const std::pair<fr, fr>> operator[](size_t i) const
+    {
+        return std::span(nodes).subspan(i * depth, depth);
+    }
+};
 template <typename Ctx> using hash_path = std::vector<std::pair<bb::stdlib::field_t<Ctx>, bb::stdlib::field_t<Ctx>>>;
 
 inline fr_hash_path get_new_hash_path(fr_hash_path const& old_path, uint128_t index, fr const& value)
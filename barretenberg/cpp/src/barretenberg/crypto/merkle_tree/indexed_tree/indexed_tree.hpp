@@ -1,9 +1,12 @@
 #pragma once
 #include "../../../common/thread.hpp"
+#include "../../../common/throw_or_abort.hpp"
 #include "../append_only_tree/append_only_tree.hpp"
 #include "../hash.hpp"
 #include "../hash_path.hpp"
 #include "indexed_leaf.hpp"
+#include <optional>
+#include <span>
 
 namespace bb::crypto::merkle_tree {
 
@@ -65,6 +68,7 @@ template <typename Store, typename LeavesStore, typename HashingPolicy>
 class IndexedTree : public AppendOnlyTree<Store, HashingPolicy> {
   public:
     IndexedTree(Store& store, size_t depth, size_t initial_size = 1, uint8_t tree_id = 0);
+    IndexedTree(Store& store, LeavesStore leaves, size_t depth, size_t initial_size = 1, uint8_t tree_id = 0);
     IndexedTree(IndexedTree const& other) = delete;
     IndexedTree(IndexedTree&& other) = delete;
     ~IndexedTree();
@@ -131,7 +135,18 @@ IndexedTree<Store, LeavesStore, HashingPolicy>::IndexedTree(Store& store,
                                                             size_t depth,
                                                             size_t initial_size,
                                                             uint8_t tree_id)
+    : IndexedTree(store, LeavesStore(), depth, initial_size, tree_id)
+{}
+
+/**
+ * @brief Construct the tree over the given leaves; if they are not empty (e.g. a PersistentLeavesStore reopened along
+ * with its node store), the tree resumes from them instead of inserting the initial leaves
+ */
+template <typename Store, typename LeavesStore, typename HashingPolicy>
+IndexedTree<Store, LeavesStore, HashingPolicy>::IndexedTree(
+    Store& store, LeavesStore leaves, size_t depth, size_t initial_size, uint8_t tree_id)
     : AppendOnlyTree<Store, HashingPolicy>(store, depth, tree_id)
+    , leaves_(std::move(leaves))
 {
     ASSERT(initial_size > 0);
     zero_hashes_.resize(depth + 1);
@@ -144,6 +159,14 @@ IndexedTree<Store, LeavesStore, HashingPolicy>::IndexedTree(Store& store,
         current = HashingPolicy::hash_pair(current, current);
     }
     zero_hashes_[0] = current;
+
+    if (leaves_.get_size() > 0) {
+        if (leaves_.get_size() != AppendOnlyTree<Store, HashingPolicy>::size()) {
+            throw_or_abort("IndexedTree: the leaves and nodes of the tree are out of sync");
+        }
+        return;
+    }
+
     // Inserts the initial set of leaves as a chain in incrementing value order
     for (size_t i = 0; i < initial_size; ++i) {
         // Insert the zero leaf to the `leaves` and also to the tree at index 0.
@@ -206,44 +229,97 @@ std::vector<fr_hash_path> IndexedTree<Store, LeavesStore, HashingPolicy>::add_or
     std::sort(values_sorted.begin(), values_sorted.end(), comp);
 
     // Now that we have the sorted values we need to identify the leaves that need updating.
-    // This is performed sequentially and is stored in this 'leaf_insertion' struct
+    // This is performed in parallel and is stored in this 'leaf_insertion' struct
     struct leaf_insertion {
         index_t low_leaf_index;
         indexed_leaf low_leaf;
+        // Set if the value is new to the tree, in which case the low leaf is updated to point to it
+        std::optional<indexed_leaf> new_leaf;
     };
 
-    std::vector<leaf_insertion> insertions(values.size());
+    const size_t num_values = values_sorted.size();
+    std::vector<leaf_insertion> insertions(num_values);
     index_t old_size = leaves_.get_size();
-
-    for (size_t i = 0; i < values_sorted.size(); ++i) {
-        fr value = values_sorted[i].first;
-        index_t index_of_new_leaf = index_t(values_sorted[i].second) + old_size;
-
-        // This gives us the leaf that need updating
-        index_t current;
-        bool is_already_present;
-        std::tie(is_already_present, current) = leaves_.find_low_value(values_sorted[i].first);
-        indexed_leaf current_leaf = leaves_.get_leaf(current);
-
-        indexed_leaf new_leaf =
-            indexed_leaf{ .value = value, .nextIndex = current_leaf.nextIndex, .nextValue = current_leaf.nextValue };
-
-        // We only handle new values being added. We don't yet handle values being updated
-        if (!is_already_present) {
-            // Update the current leaf to point it to the new leaf
-            current_leaf.nextIndex = index_of_new_leaf;
-            current_leaf.nextValue = value;
-
-            leaves_.set_at_index(current, current_leaf, false);
-            leaves_.set_at_index(index_of_new_leaf, new_leaf, true);
+    constexpr size_t MIN_VALUES_PER_THREAD = 64;
+    const size_t no_multithreading_if_less_or_equal = no_multithreading ? num_values : MIN_VALUES_PER_THREAD;
+
+    // The values are inserted in descending order, so none of them can be the low value of another that has yet to be
+    // inserted: the low values of the whole batch are found up front, each thread searching the leaves' index for a
+    // contiguous range of the values in a single pass
+    std::vector<fr> values_ascending(num_values);
+    std::vector<size_t> first_occurrences(num_values);
+    for (size_t i = 0; i < num_values; ++i) {
+        values_ascending[i] = values_sorted[num_values - 1 - i].first;
+        const bool is_repeated = i > 0 && values_sorted[i - 1].first == values_sorted[i].first;
+        first_occurrences[i] = is_repeated ? first_occurrences[i - 1] : i;
+    }
+    std::vector<std::pair<bool, index_t>> low_values(num_values);
+    run_loop_in_parallel(
+        num_values,
+        [&](size_t start, size_t end) {
+            const std::span<const fr> range(values_ascending.begin() + static_cast<ptrdiff_t>(start), end - start);
+            const auto found = leaves_.find_low_values(range);
+            std::copy(found.begin(), found.end(), low_values.begin() + static_cast<ptrdiff_t>(start));
+        },
+        no_multithreading_if_less_or_equal);
+
+    // Values sharing a low leaf are adjacent in the batch. Each of them points the low leaf to itself in turn, taking
+    // over what the low leaf pointed to, which is the original leaf or the next greater value of the batch. A value
+    // repeated in the batch is present from its second occurrence on, in the leaf written for its first occurrence.
+    // So each insertion can be resolved independently of the others
+    auto index_of_new_leaf = [&](size_t i) { return index_t(values_sorted[i].second) + old_size; };
+    auto low_value = [&](size_t i) { return low_values[num_values - 1 - i]; };
+    // The low leaf of the first occurrence of a value, as it is just before that value is inserted
+    auto low_leaf_before = [&](size_t i) {
+        const index_t low_leaf_index = low_value(i).second;
+        indexed_leaf low_leaf = leaves_.get_leaf(low_leaf_index);
+        if (i > 0) {
+            const size_t previous = first_occurrences[i - 1];
+            if (low_value(previous).second == low_leaf_index) {
+                low_leaf.nextIndex = index_of_new_leaf(previous);
+                low_leaf.nextValue = values_sorted[previous].first;
+            }
         }
+        return low_leaf;
+    };
 
-        // Capture the index and value of the updated 'low' leaf
-        leaf_insertion& insertion = insertions[i];
-        insertion.low_leaf_index = current;
-        insertion.low_leaf = indexed_leaf{ .value = current_leaf.value,
-                                           .nextIndex = current_leaf.nextIndex,
-                                           .nextValue = current_leaf.nextValue };
+    run_loop_in_parallel(
+        num_values,
+        [&](size_t start, size_t end) {
+            for (size_t i = start; i < end; ++i) {
+                const size_t first = first_occurrences[i];
+                const auto [is_already_present, low_leaf_index] = low_value(first);
+                const indexed_leaf low_leaf = low_leaf_before(first);
+                const fr value = values_sorted[i].first;
+                const indexed_leaf new_leaf{ .value = value,
+                                             .nextIndex = low_leaf.nextIndex,
+                                             .nextValue = low_leaf.nextValue };
+                leaf_insertion& insertion = insertions[i];
+
+                if (is_already_present) {
+                    insertion.low_leaf_index = low_leaf_index;
+                    insertion.low_leaf = low_leaf;
+                } else if (first != i) {
+                    // Present in the leaf of the first occurrence
+                    insertion.low_leaf_index = index_of_new_leaf(first);
+                    insertion.low_leaf = new_leaf;
+                } else {
+                    insertion.new_leaf = new_leaf;
+                    insertion.low_leaf_index = low_leaf_index;
+                    insertion.low_leaf =
+                        indexed_leaf{ .value = low_leaf.value, .nextIndex = index_of_new_leaf(i), .nextValue = value };
+                }
+            }
+        },
+        no_multithreading_if_less_or_equal);
+
+    // Apply the updates to the leaves in batch order, leaving a low leaf shared by several values pointing to the least
+    for (size_t i = 0; i < num_values; ++i) {
+        const leaf_insertion& insertion = insertions[i];
+        if (insertion.new_leaf.has_value()) {
+            leaves_.set_at_index(insertion.low_leaf_index, insertion.low_leaf, false);
+            leaves_.set_at_index(index_of_new_leaf(i), insertion.new_leaf.value(), true);
+        }
     }
 
     // We now kick off multiple workers to perform the low leaf updates
@@ -6,6 +6,8 @@
 #include "barretenberg/common/test.hpp"
 #include "barretenberg/numeric/random/engine.hpp"
 #include "leaves_cache.hpp"
+#include <random>
+#include <set>
 
 using namespace bb;
 using namespace bb::crypto::merkle_tree;
@@ -150,6 +152,69 @@ bool check_hash_path(const fr& root, const fr_hash_path& path, const indexed_lea
     return current == root;
 }
 
+/**
+ * @brief Batches large enough to be resolved in parallel, with many values sharing a low leaf, values repeated within
+ * the batch and values already in the tree
+ *
+ */
+TEST(stdlib_indexed_tree, test_batch_insert_clustered_values)
+{
+    const size_t batch_size = 128;
+    const size_t num_batches = 4;
+    size_t depth = 12;
+    NullifierMemoryTree<HashPolicy> memdb(depth, batch_size);
+
+    ArrayStore store1(depth, 4096);
+    IndexedTree<ArrayStore, LeavesCache, HashPolicy> tree1 =
+        IndexedTree<ArrayStore, LeavesCache, HashPolicy>(store1, depth, batch_size);
+
+    ArrayStore store2(depth, 4096);
+    IndexedTree<ArrayStore, LeavesCache, HashPolicy> tree2 =
+        IndexedTree<ArrayStore, LeavesCache, HashPolicy>(store2, depth, batch_size);
+
+    // Distinct values, few enough apart that most of them share their low leaf with others of their batch
+    std::vector<fr> distinct_values(num_batches * batch_size);
+    for (size_t i = 0; i < distinct_values.size(); ++i) {
+        distinct_values[i] = fr(batch_size + i);
+    }
+    std::shuffle(distinct_values.begin(), distinct_values.end(), std::mt19937(engine.get_random_uint32()));
+    for (size_t i = 0; i < num_batches; i++) {
+        std::vector<fr> batch(distinct_values.begin() + static_cast<ptrdiff_t>(i * batch_size),
+                              distinct_values.begin() + static_cast<ptrdiff_t>((i + 1) * batch_size));
+        for (const auto& value : batch) {
+            memdb.update_element(value);
+        }
+        EXPECT_EQ(tree1.add_or_update_values(batch, true), tree2.add_or_update_values(batch));
+        EXPECT_EQ(memdb.root(), tree1.root());
+        EXPECT_EQ(tree1.root(), tree2.root());
+    }
+
+    // Values repeated within the batch and values already present
+    for (size_t i = 0; i < num_batches; i++) {
+        std::vector<fr> batch(batch_size);
+        for (auto& value : batch) {
+            value = fr(engine.get_random_uint16() % (2 * num_batches * batch_size));
+        }
+        EXPECT_EQ(tree1.add_or_update_values(batch, true), tree2.add_or_update_values(batch));
+        EXPECT_EQ(tree1.root(), tree2.root());
+    }
+
+    // The leaves still form a single chain through every value in increasing order, and are all in the tree
+    std::set<uint256_t> values;
+    for (size_t i = 0; i < size_t(tree2.size()); ++i) {
+        indexed_leaf leaf = tree2.get_leaf(i);
+        EXPECT_TRUE(check_hash_path(tree2.root(), tree2.get_hash_path(i), leaf, i));
+        values.insert(uint256_t(leaf.value));
+    }
+    indexed_leaf leaf = tree2.get_leaf(0);
+    for (auto it = std::next(values.begin()); it != values.end(); ++it) {
+        EXPECT_EQ(uint256_t(leaf.nextValue), *it);
+        leaf = tree2.get_leaf(leaf.nextIndex);
+        EXPECT_EQ(uint256_t(leaf.value), *it);
+    }
+    EXPECT_EQ(leaf.nextIndex, 0);
+}
+
 TEST(stdlib_indexed_tree, test_indexed_memory)
 {
     // Create a depth-3 indexed merkle tree
@@ -9,22 +9,18 @@ index_t LeavesCache::get_size() const
 
 std::pair<bool, index_t> LeavesCache::find_low_value(const fr& new_value) const
 {
-    std::map<uint256_t, index_t>::const_iterator it = indices_.lower_bound(new_value);
-    if (it == indices_.end()) {
-        // there is no element >= the requested value.
-        // decrement the iterator to get the value preceeding the requested value
-        --it;
-        return std::make_pair(false, it->second);
-    }
-    if (it->first == uint256_t(new_value)) {
-        // the value is already present and the iterator points to it
-        return std::make_pair(true, it->second);
+    return indices_.find_low(uint256_t(new_value));
+}
+
+std::vector<std::pair<bool, index_t>> LeavesCache::find_low_values(std::span<const fr> new_values) const
+{
+    std::vector<uint256_t> keys(new_values.size());
+    for (size_t i = 0; i < new_values.size(); ++i) {
+        keys[i] = uint256_t(new_values[i]);
     }
-    // the iterator points to the element immediately larger than the requested value
-    --it;
-    //  it now points to the value less than that requested
-    return std::make_pair(false, it->second);
+    return indices_.find_low(keys);
 }
+
 indexed_leaf LeavesCache::get_leaf(const index_t& index) const
 {
     ASSERT(index >= 0 && index < leaves_.size());
@@ -37,7 +33,7 @@ void LeavesCache::set_at_index(const index_t& index, const indexed_leaf& leaf, b
     }
     leaves_[size_t(index)] = leaf;
     if (add_to_index) {
-        indices_[uint256_t(leaf.value)] = index;
+        indices_.set(uint256_t(leaf.value), index);
     }
 }
 void LeavesCache::append_leaf(const indexed_leaf& leaf)
@@ -1,6 +1,7 @@
 #pragma once
 #include "barretenberg/stdlib/primitives/field/field.hpp"
 #include "indexed_leaf.hpp"
+#include "sorted_leaf_index.hpp"
 
 namespace bb::crypto::merkle_tree {
 
@@ -8,19 +9,23 @@ typedef uint256_t index_t;
 
 /**
  * @brief Used to facilitate testing of the IndexedTree. Stores leaves in memory with an index for O(logN) retrieval of
- * 'low leaves'
+ * 'low leaves', individually or for a whole sorted batch at once
  *
  */
 class LeavesCache {
   public:
     index_t get_size() const;
     std::pair<bool, index_t> find_low_value(const bb::fr& new_value) const;
+    /**
+     * @brief find_low_value for each of the given values, which must be in increasing order
+     */
+    std::vector<std::pair<bool, index_t>> find_low_values(std::span<const bb::fr> new_values) const;
     indexed_leaf get_leaf(const index_t& index) const;
     void set_at_index(const index_t& index, const indexed_leaf& leaf, bool add_to_index);
     void append_leaf(const indexed_leaf& leaf);
 
-  private:
-    std::map<uint256_t, index_t> indices_;
+  protected:
+    SortedLeafIndex indices_;
     std::vector<indexed_leaf> leaves_;
 };
 
@@ -0,0 +1,79 @@
+#include "persistent_leaves_store.hpp"
+#include "barretenberg/common/serialize.hpp"
+
+namespace bb::crypto::merkle_tree {
+
+namespace {
+std::vector<uint8_t> encode_leaf(const indexed_leaf& leaf, bool indexed)
+{
+    std::vector<uint8_t> buf;
+    write(buf, leaf.value);
+    write(buf, leaf.nextIndex);
+    write(buf, leaf.nextValue);
+    write(buf, static_cast<uint8_t>(indexed));
+    return buf;
+}
+} // namespace
+
+PersistentLeavesStore::PersistentLeavesStore(PersistentStore& store, size_t depth)
+    : store_(store)
+    , level_(depth + 1)
+{
+    store_.for_each_node(level_, [&](size_t index, const std::vector<uint8_t>& buf) {
+        const indexed_leaf leaf{ .value = from_buffer<fr>(buf, 0),
+                                 .nextIndex = from_buffer<index_t>(buf, 32),
+                                 .nextValue = from_buffer<fr>(buf, 64) };
+        LeavesCache::set_at_index(index, leaf, buf[96] != 0);
+    });
+    committed_size_ = leaves_.size();
+}
+
+void PersistentLeavesStore::set_at_index(const index_t& index, const indexed_leaf& leaf, bool add_to_index)
+{
+    const auto leaf_index = static_cast<size_t>(index);
+    if (leaf_index < committed_size_ && !overwritten_leaves_.contains(leaf_index)) {
+        overwritten_leaves_.emplace(leaf_index, leaves_[leaf_index]);
+    }
+    if (add_to_index) {
+        overwritten_indices_.emplace_back(uint256_t(leaf.value), indices_.find(uint256_t(leaf.value)));
+    }
+    LeavesCache::set_at_index(index, leaf, add_to_index);
+
+    // Record whether the value is indexed, rather than whether this update added it, for the index to be rebuilt
+    const bool indexed = indices_.find(uint256_t(leaf.value)) == index;
+    store_.put(level_, leaf_index, encode_leaf(leaf, indexed));
+}
+
+void PersistentLeavesStore::append_leaf(const indexed_leaf& leaf)
+{
+    set_at_index(index_t(leaves_.size()), leaf, true);
+}
+
+uint64_t PersistentLeavesStore::commit()
+{
+    const uint64_t version = store_.commit();
+    committed_size_ = leaves_.size();
+    overwritten_leaves_.clear();
+    overwritten_indices_.clear();
+    return version;
+}
+
+void PersistentLeavesStore::rollback()
+{
+    store_.rollback();
+    for (auto it = overwritten_indices_.rbegin(); it != overwritten_indices_.rend(); ++it) {
+        if (it->second.has_value()) {
+            indices_.set(it->first, *it->second);
+        } else {
+            indices_.erase(it->first);
+        }
+    }
+    for (const auto& [index, leaf] : overwritten_leaves_) {
+        leaves_[index] = leaf;
+    }
+    leaves_.resize(committed_size_);
+    overwritten_leaves_.clear();
+    overwritten_indices_.clear();
+}
+
+} // namespace bb::crypto::merkle_tree
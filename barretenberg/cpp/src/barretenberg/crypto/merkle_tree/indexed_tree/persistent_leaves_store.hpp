@@ -0,0 +1,44 @@
+#pragma once
+#include "../persistent_store.hpp"
+#include "leaves_cache.hpp"
+#include <map>
+#include <optional>
+
+namespace bb::crypto::merkle_tree {
+
+/**
+ * @brief A LeavesCache whose leaves are persisted in the PersistentStore holding the nodes of the tree
+ * @details Serves lookups from memory exactly like LeavesCache, while every leaf set is also written to the node store
+ * at a level past the depth of the tree, from which the leaves and their index are rebuilt on opening. Leaves and
+ * nodes thus live in the same transactions, so an IndexedTree over the two stores resumes from its last committed state
+ * on restart.
+ */
+class PersistentLeavesStore : public LeavesCache {
+  public:
+    PersistentLeavesStore(PersistentStore& store, size_t depth);
+
+    void set_at_index(const index_t& index, const indexed_leaf& leaf, bool add_to_index);
+    void append_leaf(const indexed_leaf& leaf);
+
+    /**
+     * @brief Commit the node store, which holds the leaves, returning the version produced
+     */
+    uint64_t commit();
+
+    /**
+     * @brief Roll back the node store and restore the leaves and index to their state at the last commit
+     */
+    void rollback();
+
+  private:
+    PersistentStore& store_;
+    size_t level_;
+
+    // What is needed to undo the leaves set since the last commit: the number of leaves then, the previous state of the
+    // leaves overwritten and of the index entries set
+    size_t committed_size_ = 0;
+    std::map<size_t, indexed_leaf> overwritten_leaves_;
+    std::vector<std::pair<uint256_t, std::optional<index_t>>> overwritten_indices_;
+};
+
+} // namespace bb::crypto::merkle_tree
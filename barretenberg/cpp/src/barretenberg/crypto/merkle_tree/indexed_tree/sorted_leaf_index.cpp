@@ -0,0 +1,146 @@
+#include "sorted_leaf_index.hpp"
+#include "barretenberg/common/assert.hpp"
+#include <algorithm>
+
+namespace bb::crypto::merkle_tree {
+
+namespace {
+using Entry = std::pair<uint256_t, uint64_t>;
+
+// Blocks are split in two past this size, so an insertion shifts 64 entries on average
+constexpr size_t MAX_BLOCK_SIZE = 128;
+
+std::vector<Entry>::const_iterator lower_bound(const std::vector<Entry>& block, const uint256_t& key)
+{
+    return std::lower_bound(
+        block.begin(), block.end(), key, [](const Entry& entry, const uint256_t& k) { return entry.first < k; });
+}
+
+std::vector<Entry>::const_iterator upper_bound(const std::vector<Entry>& block, const uint256_t& key)
+{
+    return std::upper_bound(
+        block.begin(), block.end(), key, [](const uint256_t& k, const Entry& entry) { return k < entry.first; });
+}
+
+/**
+ * @brief Returns the first key of [first, last) greater than key, searching exponentially further from first so that
+ * a lookup costs the log of the distance travelled rather than of the size of the range
+ */
+std::vector<uint256_t>::const_iterator gallop_upper_bound(std::vector<uint256_t>::const_iterator first,
+                                                          std::vector<uint256_t>::const_iterator last,
+                                                          const uint256_t& key)
+{
+    auto low = first;
+    ptrdiff_t step = 1;
+    while (step < last - low && !(key < *(low + step))) {
+        low += step;
+        step *= 2;
+    }
+    return std::upper_bound(low, step < last - low ? low + step : last, key);
+}
+} // namespace
+
+/**
+ * @brief Returns the position of the block that holds key, or would if it were present: the last block whose first key
+ * is not greater than key, or the first block for keys smaller than all
+ */
+size_t SortedLeafIndex::find_block(const uint256_t& key) const
+{
+    auto it = std::upper_bound(first_keys_.begin(), first_keys_.end(), key);
+    return it == first_keys_.begin() ? 0 : static_cast<size_t>(it - first_keys_.begin()) - 1;
+}
+
+void SortedLeafIndex::set(const uint256_t& key, const index_t& index)
+{
+    const Entry entry(key, static_cast<uint64_t>(index));
+    if (blocks_.empty()) {
+        blocks_.push_back({ entry });
+        first_keys_.push_back(key);
+        ++size_;
+        return;
+    }
+
+    const size_t block_index = find_block(key);
+    std::vector<Entry>& block = blocks_[block_index];
+    auto it = block.begin() + (lower_bound(block, key) - block.cbegin());
+    if (it != block.end() && it->first == key) {
+        it->second = entry.second;
+        return;
+    }
+    block.insert(it, entry);
+    first_keys_[block_index] = block.front().first;
+    ++size_;
+
+    if (block.size() > MAX_BLOCK_SIZE) {
+        const auto middle = block.begin() + static_cast<ptrdiff_t>(block.size() / 2);
+        std::vector<Entry> upper_half(middle, block.end());
+        block.erase(middle, block.end());
+        const auto position = static_cast<ptrdiff_t>(block_index + 1);
+        first_keys_.insert(first_keys_.begin() + position, upper_half.front().first);
+        blocks_.insert(blocks_.begin() + position, std::move(upper_half));
+    }
+}
+
+void SortedLeafIndex::erase(const uint256_t& key)
+{
+    if (blocks_.empty()) {
+        return;
+    }
+    const size_t block_index = find_block(key);
+    std::vector<Entry>& block = blocks_[block_index];
+    auto it = lower_bound(block, key);
+    if (it == block.end() || it->first != key) {
+        return;
+    }
+    block.erase(it);
+    --size_;
+
+    if (block.empty()) {
+        const auto position = static_cast<ptrdiff_t>(block_index);
+        first_keys_.erase(first_keys_.begin() + position);
+        blocks_.erase(blocks_.begin() + position);
+    } else {
+        first_keys_[block_index] = block.front().first;
+    }
+}
+
+std::optional<index_t> SortedLeafIndex::find(const uint256_t& key) const
+{
+    if (blocks_.empty()) {
+        return std::nullopt;
+    }
+    const std::vector<Entry>& block = blocks_[find_block(key)];
+    auto it = lower_bound(block, key);
+    if (it == block.end() || it->first != key) {
+        return std::nullopt;
+    }
+    return index_t(it->second);
+}
+
+std::pair<bool, index_t> SortedLeafIndex::find_low(const uint256_t& key) const
+{
+    auto block_it = std::upper_bound(first_keys_.begin(), first_keys_.end(), key);
+    ASSERT(block_it != first_keys_.begin());
+    const std::vector<Entry>& block = blocks_[static_cast<size_t>(block_it - first_keys_.begin()) - 1];
+    // The first key of the block is not greater than key, so the entry before the bound exists
+    const Entry& low = *std::prev(upper_bound(block, key));
+    return std::make_pair(low.first == key, index_t(low.second));
+}
+
+std::vector<std::pair<bool, index_t>> SortedLeafIndex::find_low(std::span<const uint256_t> keys) const
+{
+    std::vector<std::pair<bool, index_t>> result(keys.size());
+    // As the keys are increasing, the search for each one resumes from the block of the previous one
+    auto block_it = first_keys_.begin();
+    for (size_t i = 0; i < keys.size(); ++i) {
+        ASSERT(i == 0 || !(keys[i] < keys[i - 1]));
+        block_it = gallop_upper_bound(block_it, first_keys_.end(), keys[i]);
+        ASSERT(block_it != first_keys_.begin());
+        const std::vector<Entry>& block = blocks_[static_cast<size_t>(block_it - first_keys_.begin()) - 1];
+        const Entry& low = *std::prev(upper_bound(block, keys[i]));
+        result[i] = std::make_pair(low.first == keys[i], index_t(low.second));
+    }
+    return result;
+}
+
+} // namespace bb::crypto::merkle_tree
@@ -0,0 +1,60 @@
+#pragma once
+#include "barretenberg/numeric/uint256/uint256.hpp"
+#include <optional>
+#include <span>
+#include <vector>
+
+namespace bb::crypto::merkle_tree {
+
+typedef uint256_t index_t;
+
+/**
+ * @brief An ordered map from leaf values to leaf indices, answering the predecessor queries that find 'low leaves'
+ * @details A B+-tree of depth two: entries are kept in sorted blocks of bounded size, themselves ordered by the sorted
+ * array of their first keys. Lookups are binary searches over contiguous memory rather than walks over the nodes of a
+ * red-black tree, an insertion shifts at most a block's worth of entries, and memory is allocated per block rather than
+ * per entry. Reads are const and may run concurrently.
+ */
+class SortedLeafIndex {
+  public:
+    /**
+     * @brief Maps key to index, replacing any index it was mapped to
+     */
+    void set(const uint256_t& key, const index_t& index);
+
+    /**
+     * @brief Removes key, if present
+     */
+    void erase(const uint256_t& key);
+
+    /**
+     * @brief Returns the index key is mapped to, if any
+     */
+    std::optional<index_t> find(const uint256_t& key) const;
+
+    /**
+     * @brief Returns whether key is present and the index of the greatest key not greater than it
+     * @pre A key not greater than the given one is present
+     */
+    std::pair<bool, index_t> find_low(const uint256_t& key) const;
+
+    /**
+     * @brief find_low for a batch of keys in one merge-style pass over the index
+     * @param keys The keys to look up, in increasing order
+     */
+    std::vector<std::pair<bool, index_t>> find_low(std::span<const uint256_t> keys) const;
+
+    size_t size() const { return size_; }
+
+  private:
+    // Leaf indices are bounded by the size of the tree, so are stored in 64 bits
+    using Entry = std::pair<uint256_t, uint64_t>;
+
+    size_t find_block(const uint256_t& key) const;
+
+    std::vector<uint256_t> first_keys_;
+    std::vector<std::vector<Entry>> blocks_;
+    size_t size_ = 0;
+};
+
+} // namespace bb::crypto::merkle_tree
@@ -0,0 +1,62 @@
+#include "sorted_leaf_index.hpp"
+#include "barretenberg/common/test.hpp"
+#include "barretenberg/numeric/random/engine.hpp"
+#include <map>
+
+using namespace bb;
+using namespace bb::crypto::merkle_tree;
+
+namespace {
+auto& engine = numeric::get_debug_randomness();
+
+// The greatest key not greater than the given one, as the reference for find_low
+std::pair<bool, index_t> find_low(const std::map<uint256_t, index_t>& reference, const uint256_t& key)
+{
+    auto it = std::prev(reference.upper_bound(key));
+    return std::make_pair(it->first == key, it->second);
+}
+} // namespace
+
+/**
+ * @brief Mirrors a series of random insertions, updates and removals in a std::map, through enough entries for blocks
+ * to be split many times
+ *
+ */
+TEST(crypto_sorted_leaf_index, matches_ordered_map)
+{
+    SortedLeafIndex index;
+    std::map<uint256_t, index_t> reference;
+    index.set(0, 0);
+    reference[0] = 0;
+
+    std::vector<uint256_t> keys;
+    for (size_t i = 1; i < 5000; ++i) {
+        // Small keys so that lookups hit present keys as well as absent ones
+        const uint256_t key = engine.get_random_uint16();
+        keys.push_back(key);
+        index.set(key, i);
+        reference[key] = i;
+        if (i % 7 == 0) {
+            const uint256_t removed = keys[engine.get_random_uint32() % keys.size()];
+            if (removed != 0) {
+                index.erase(removed);
+                reference.erase(removed);
+            }
+        }
+    }
+    EXPECT_EQ(index.size(), reference.size());
+
+    std::vector<uint256_t> queries(2000);
+    for (auto& query : queries) {
+        query = engine.get_random_uint16();
+        const auto it = reference.find(query);
+        EXPECT_EQ(index.find(query), it == reference.end() ? std::nullopt : std::optional<index_t>(it->second));
+        EXPECT_EQ(index.find_low(query), find_low(reference, query));
+    }
+
+    std::sort(queries.begin(), queries.end());
+    const auto low_values = index.find_low(queries);
+    for (size_t i = 0; i < queries.size(); ++i) {
+        EXPECT_EQ(low_values[i], find_low(reference, queries[i]));
+    }
+}
@@ -0,0 +1,231 @@
+#include "persistent_store.hpp"
+#include "barretenberg/common/assert.hpp"
+#include "barretenberg/common/throw_or_abort.hpp"
+#include <algorithm>
+#include <cstring>
+
+namespace bb::crypto::merkle_tree {
+
+namespace {
+struct EncodedKey {
+    uint64_t level;
+    uint64_t index;
+};
+
+std::vector<uint8_t> encode_key(size_t level, size_t index)
+{
+    const EncodedKey encoded{ level, index };
+    std::vector<uint8_t> key(sizeof(encoded));
+    std::memcpy(key.data(), &encoded, sizeof(encoded));
+    return key;
+}
+} // namespace
+
+PersistentStore::PersistentStore(const std::string& path, size_t levels)
+    : leaf_level_(levels)
+    , log_(path,
+           [this](uint64_t version, std::span<const uint8_t> key, std::span<const uint8_t> value, uint64_t offset) {
+               ASSERT(key.size() == sizeof(EncodedKey));
+               EncodedKey encoded;
+               std::memcpy(&encoded, key.data(), sizeof(encoded));
+               directory_[{ static_cast<size_t>(encoded.level), static_cast<size_t>(encoded.index) }].push_back(
+                   { version, offset, static_cast<uint32_t>(value.size()) });
+           })
+{
+    // A leaf counts from the first version it was written at, versions without any leaf written keep the leaf count of
+    // their predecessor
+    const uint64_t base_version = log_.base_version();
+    leaf_counts_.assign(log_.version() - base_version + 1, 0);
+    for (const auto& [key, versions] : directory_) {
+        if (key.level == leaf_level_) {
+            auto& count = leaf_counts_[versions.front().version - base_version];
+            count = std::max(count, key.index + 1);
+        }
+    }
+    for (size_t i = 1; i < leaf_counts_.size(); ++i) {
+        leaf_counts_[i] = std::max(leaf_counts_[i], leaf_counts_[i - 1]);
+    }
+    pending_leaf_count_ = leaf_counts_.back();
+}
+
+void PersistentStore::check_readable(uint64_t version) const
+{
+    if (version < log_.base_version()) {
+        throw_or_abort("PersistentStore: version " + std::to_string(version) + " predates the last compaction");
+    }
+}
+
+void PersistentStore::put(size_t level, size_t index, const std::vector<uint8_t>& data)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    pending_[{ level, index }] = data;
+    if (level == leaf_level_) {
+        pending_leaf_count_ = std::max(pending_leaf_count_, index + 1);
+    }
+}
+
+bool PersistentStore::get(size_t level, size_t index, std::vector<uint8_t>& data) const
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = pending_.find({ level, index });
+        if (it != pending_.end()) {
+            data = it->second;
+            return true;
+        }
+    }
+    return get(level, index, data, version());
+}
+
+bool PersistentStore::get(size_t level, size_t index, std::vector<uint8_t>& data, uint64_t version) const
+{
+    NodeVersion node_version;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        check_readable(version);
+        auto it = directory_.find({ level, index });
+        if (it == directory_.end()) {
+            return false;
+        }
+        // The last version of the node written at or before the requested version
+        const auto& versions = it->second;
+        auto version_it = std::upper_bound(versions.begin(),
+                                           versions.end(),
+                                           version,
+                                           [](uint64_t v, const NodeVersion& nv) { return v < nv.version; });
+        if (version_it == versions.begin()) {
+            return false;
+        }
+        node_version = *std::prev(version_it);
+    }
+    data.resize(node_version.size);
+    log_.read(node_version.offset, data.data(), data.size());
+    return true;
+}
+
+uint64_t PersistentStore::commit()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (pending_.empty()) {
+        return log_.version();
+    }
+
+    std::vector<NodeKey> keys;
+    std::vector<TransactionLog::Entry> entries;
+    keys.reserve(pending_.size());
+    entries.reserve(pending_.size());
+    for (auto& [key, value] : pending_) {
+        keys.push_back(key);
+        entries.push_back({ encode_key(key.level, key.index), std::move(value) });
+    }
+
+    std::vector<uint64_t> offsets;
+    const uint64_t version = log_.append(entries, offsets);
+    for (size_t i = 0; i < keys.size(); ++i) {
+        directory_[keys[i]].push_back({ version, offsets[i], static_cast<uint32_t>(entries[i].value.size()) });
+    }
+    leaf_counts_.push_back(pending_leaf_count_);
+    pending_.clear();
+    return version;
+}
+
+void PersistentStore::compact()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (log_.version() == log_.base_version()) {
+        return;
+    }
+
+    std::vector<NodeKey> keys;
+    std::vector<TransactionLog::Entry> entries;
+    keys.reserve(directory_.size());
+    entries.reserve(directory_.size());
+    for (const auto& [key, versions] : directory_) {
+        std::vector<uint8_t> value(versions.back().size);
+        log_.read(versions.back().offset, value.data(), value.size());
+        keys.push_back(key);
+        entries.push_back({ encode_key(key.level, key.index), std::move(value) });
+    }
+
+    std::vector<uint64_t> offsets;
+    log_.checkpoint(entries, offsets);
+    for (size_t i = 0; i < keys.size(); ++i) {
+        auto& versions = directory_[keys[i]];
+        versions.assign(1, { log_.version(), offsets[i], static_cast<uint32_t>(entries[i].value.size()) });
+        versions.shrink_to_fit();
+    }
+    leaf_counts_.assign(1, leaf_counts_.back());
+    leaf_counts_.shrink_to_fit();
+}
+
+void PersistentStore::rollback()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    pending_.clear();
+    pending_leaf_count_ = leaf_counts_.back();
+}
+
+uint64_t PersistentStore::version() const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return log_.version();
+}
+
+size_t PersistentStore::leaf_count() const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return pending_leaf_count_;
+}
+
+uint64_t PersistentStore::base_version() const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return log_.base_version();
+}
+
+size_t PersistentStore::leaf_count(uint64_t version) const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    check_readable(version);
+    ASSERT(version <= log_.version());
+    return leaf_counts_[version - log_.base_version()];
+}
+
+void PersistentStore::for_each_node(size_t level,
+                                    const std::function<void(size_t, const std::vector<uint8_t>&)>& fn) const
+{
+    std::vector<std::pair<size_t, NodeVersion>> nodes;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        for (const auto& [key, versions] : directory_) {
+            if (key.level == level) {
+                nodes.emplace_back(key.index, versions.back());
+            }
+        }
+    }
+    std::sort(nodes.begin(), nodes.end(), [](const auto& a, const auto& b) { return a.first < b.first; });
+
+    std::vector<uint8_t> data;
+    for (const auto& [index, node_version] : nodes) {
+        data.resize(node_version.size);
+        log_.read(node_version.offset, data.data(), data.size());
+        fn(index, data);
+    }
+}
+
+PersistentStore::Snapshot PersistentStore::snapshot(uint64_t version) const
+{
+    ASSERT(version <= this->version());
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        check_readable(version);
+    }
+    return Snapshot(this, version);
+}
+
+void PersistentStore::Snapshot::put(size_t, size_t, const std::vector<uint8_t>&)
+{
+    throw_or_abort("PersistentStore::Snapshot: snapshots are read-only");
+}
+
+} // namespace bb::crypto::merkle_tree
@@ -0,0 +1,146 @@
+#pragma once
+#include "transaction_log.hpp"
+#include <functional>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace bb::crypto::merkle_tree {
+
+/**
+ * @brief A disk-backed node store for merkle trees with batched write transactions and snapshots
+ * @details A drop-in replacement for ArrayStore that outlives the process. Writes are buffered in memory until commit,
+ * which durably appends them to a TransactionLog as a single transaction and produces a new version of the store;
+ * rollback discards them. Node values are read back from the file, only the location of each version of each node is
+ * kept in memory (rebuilt by scanning the log on opening). Since nodes are never overwritten on disk, the state at any
+ * committed version remains readable through a Snapshot, until the store is compacted: both the file and the versions
+ * kept in memory grow with every commit, so long-running users are expected to compact the store periodically.
+ *
+ * A tree constructed over a store holding committed nodes resumes from them (see AppendOnlyTree), so trees need not be
+ * rebuilt on restart.
+ */
+class PersistentStore {
+  public:
+    class Snapshot;
+
+    /**
+     * @param path The file holding the store, created if it does not exist
+     * @param levels The depth of the tree, i.e. the level of its leaves
+     */
+    PersistentStore(const std::string& path, size_t levels);
+    PersistentStore(const PersistentStore& other) = delete;
+    PersistentStore(PersistentStore&& other) = delete;
+    PersistentStore& operator=(const PersistentStore& other) = delete;
+    PersistentStore& operator=(PersistentStore&& other) = delete;
+    ~PersistentStore() = default;
+
+    void put(size_t level, size_t index, const std::vector<uint8_t>& data);
+    bool get(size_t level, size_t index, std::vector<uint8_t>& data) const;
+
+    /**
+     * @brief Durably write all the nodes put since the last commit, returning the version of the store they produce
+     */
+    uint64_t commit();
+
+    /**
+     * @brief Discard all the nodes put since the last commit
+     * @note Trees over the store cache their root and size, so they must be reconstructed after a rollback
+     */
+    void rollback();
+
+    /**
+     * @brief Returns the version produced by the last commit
+     */
+    uint64_t version() const;
+
+    /**
+     * @brief Returns the number of leaves, i.e. one past the highest index written at the leaf level
+     */
+    size_t leaf_count() const;
+
+    /**
+     * @brief Invoke fn with the index and latest committed value of every node at the given level
+     * @details Levels past the depth of the tree are free to hold auxiliary data committed along with its nodes (see
+     * PersistentLeavesStore), which is read back through this on opening.
+     */
+    void for_each_node(size_t level, const std::function<void(size_t, const std::vector<uint8_t>&)>& fn) const;
+
+    /**
+     * @brief Returns a read-only view of the store as of the given committed version, which must not predate the last
+     * compaction
+     */
+    Snapshot snapshot(uint64_t version) const;
+
+    /**
+     * @brief Durably rewrite the file with only the latest committed value of each node, dropping all earlier versions
+     * @details The version of the store is unchanged and uncommitted nodes are kept. Reading from a snapshot of an
+     * earlier version fails afterwards. The live nodes are held in memory while the new file is written.
+     */
+    void compact();
+
+    /**
+     * @brief Returns the oldest version that can still be read, i.e. the version of the last compaction
+     */
+    uint64_t base_version() const;
+
+  private:
+    struct NodeKey {
+        size_t level;
+        size_t index;
+        bool operator==(const NodeKey& other) const = default;
+    };
+    struct NodeKeyHash {
+        size_t operator()(const NodeKey& key) const { return std::hash<size_t>()(key.index * 64 + key.level); }
+    };
+    // The location in the log of the value a node took at some version
+    struct NodeVersion {
+        uint64_t version;
+        uint64_t offset;
+        uint32_t size;
+    };
+
+    bool get(size_t level, size_t index, std::vector<uint8_t>& data, uint64_t version) const;
+    size_t leaf_count(uint64_t version) const;
+    void check_readable(uint64_t version) const;
+
+    size_t leaf_level_;
+    // Versions of each committed node since the last compaction, in increasing order
+    std::unordered_map<NodeKey, std::vector<NodeVersion>, NodeKeyHash> directory_;
+    // The number of leaves at each version since the last compaction
+    std::vector<size_t> leaf_counts_;
+    TransactionLog log_;
+
+    std::unordered_map<NodeKey, std::vector<uint8_t>, NodeKeyHash> pending_;
+    size_t pending_leaf_count_;
+
+    // Trees may write nodes from several threads at once
+    mutable std::mutex mutex_;
+};
+
+/**
+ * @brief A read-only view of a PersistentStore at a committed version, e.g. to serve hash paths against an earlier root
+ * while the tree keeps being updated
+ */
+class PersistentStore::Snapshot {
+  public:
+    void put(size_t level, size_t index, const std::vector<uint8_t>& data);
+    bool get(size_t level, size_t index, std::vector<uint8_t>& data) const
+    {
+        return store_->get(level, index, data, version_);
+    }
+    size_t leaf_count() const { return store_->leaf_count(version_); }
+    uint64_t version() const { return version_; }
+
+  private:
+    friend class PersistentStore;
+    Snapshot(const PersistentStore* store, uint64_t version)
+        : store_(store)
+        , version_(version)
+    {}
+
+    const PersistentStore* store_;
+    uint64_t version_;
+};
+
+} // namespace bb::crypto::merkle_tree
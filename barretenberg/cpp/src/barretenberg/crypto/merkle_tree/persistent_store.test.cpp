@@ -0,0 +1,369 @@
+#include "persistent_store.hpp"
+#include "append_only_tree/append_only_tree.hpp"
+#include "array_store.hpp"
+#include "barretenberg/common/test.hpp"
+#include "barretenberg/numeric/random/engine.hpp"
+#include "indexed_tree/indexed_tree.hpp"
+#include "indexed_tree/persistent_leaves_store.hpp"
+#include <array>
+#include <filesystem>
+#include <fstream>
+#include <span>
+
+using namespace bb;
+using namespace bb::crypto::merkle_tree;
+
+using HashPolicy = Poseidon2HashPolicy;
+
+namespace {
+auto& random_engine = numeric::get_randomness();
+
+std::vector<fr> random_values(size_t num_values)
+{
+    std::vector<fr> values(num_values);
+    for (auto& value : values) {
+        value = fr(random_engine.get_random_uint256());
+    }
+    return values;
+}
+
+class PersistentStoreTests : public ::testing::Test {
+  protected:
+    void SetUp() override
+    {
+        path = std::filesystem::temp_directory_path() /
+               ("persistent_store_test_" + std::to_string(random_engine.get_random_uint64()));
+    }
+    void TearDown() override { std::filesystem::remove(path); }
+
+    std::string path;
+};
+
+void overwrite(const std::string& path, uint64_t offset, const void* data, size_t size)
+{
+    std::fstream file(path, std::ios::binary | std::ios::in | std::ios::out);
+    file.seekp(static_cast<std::streamoff>(offset));
+    file.write(static_cast<const char*>(data), static_cast<std::streamsize>(size));
+}
+} // namespace
+
+/**
+ * @brief An append-only tree resumes from the committed nodes of a reopened store
+ *
+ */
+TEST_F(PersistentStoreTests, AppendOnlyTreeSurvivesReopening)
+{
+    constexpr size_t depth = 10;
+    auto values = random_values(96);
+
+    ArrayStore array_store(depth);
+    AppendOnlyTree<ArrayStore, HashPolicy> reference(array_store, depth);
+    reference.add_values(std::vector<fr>(values.begin(), values.begin() + 64));
+
+    {
+        PersistentStore store(path, depth);
+        AppendOnlyTree<PersistentStore, HashPolicy> tree(store, depth);
+        tree.add_values(std::vector<fr>(values.begin(), values.begin() + 32));
+        tree.add_values(std::vector<fr>(values.begin() + 32, values.begin() + 64));
+        EXPECT_EQ(store.commit(), 1);
+        EXPECT_EQ(tree.root(), reference.root());
+    }
+
+    PersistentStore store(path, depth);
+    AppendOnlyTree<PersistentStore, HashPolicy> tree(store, depth);
+    EXPECT_EQ(store.version(), 1);
+    EXPECT_EQ(tree.size(), 64);
+    EXPECT_EQ(tree.root(), reference.root());
+    EXPECT_EQ(tree.get_hash_path(17), reference.get_hash_path(17));
+
+    reference.add_values(std::vector<fr>(values.begin() + 64, values.end()));
+    tree.add_values(std::vector<fr>(values.begin() + 64, values.end()));
+    EXPECT_EQ(tree.root(), reference.root());
+    EXPECT_EQ(tree.get_hash_path(70), reference.get_hash_path(70));
+}
+
+/**
+ * @brief Uncommitted nodes, whether rolled back or lost along with the process, are discarded
+ *
+ */
+TEST_F(PersistentStoreTests, UncommittedWritesAreDiscarded)
+{
+    constexpr size_t depth = 8;
+    auto values = random_values(16);
+    fr committed_root;
+    {
+        PersistentStore store(path, depth);
+        AppendOnlyTree<PersistentStore, HashPolicy> tree(store, depth);
+        committed_root = tree.add_values(std::vector<fr>(values.begin(), values.begin() + 8));
+        store.commit();
+
+        tree.add_values(std::vector<fr>(values.begin() + 8, values.end()));
+        store.rollback();
+        EXPECT_EQ(store.leaf_count(), 8);
+        EXPECT_EQ((AppendOnlyTree<PersistentStore, HashPolicy>(store, depth).root()), committed_root);
+
+        // Never committed
+        tree.add_values(std::vector<fr>(values.begin() + 8, values.end()));
+    }
+
+    PersistentStore store(path, depth);
+    AppendOnlyTree<PersistentStore, HashPolicy> tree(store, depth);
+    EXPECT_EQ(tree.size(), 8);
+    EXPECT_EQ(tree.root(), committed_root);
+}
+
+/**
+ * @brief A transaction torn by a crash while it was being written is dropped on reopening, leaving the state of the
+ * last complete commit
+ *
+ */
+TEST_F(PersistentStoreTests, TornTransactionIsDropped)
+{
+    constexpr size_t depth = 8;
+    auto values = random_values(16);
+    fr committed_root;
+    {
+        PersistentStore store(path, depth);
+        AppendOnlyTree<PersistentStore, HashPolicy> tree(store, depth);
+        committed_root = tree.add_values(std::vector<fr>(values.begin(), values.begin() + 8));
+        store.commit();
+        tree.add_values(std::vector<fr>(values.begin() + 8, values.end()));
+        store.commit();
+    }
+
+    // Chop off the end of the last transaction
+    std::filesystem::resize_file(path, std::filesystem::file_size(path) - 100);
+    {
+        PersistentStore store(path, depth);
+        AppendOnlyTree<PersistentStore, HashPolicy> tree(store, depth);
+        EXPECT_EQ(store.version(), 1);
+        EXPECT_EQ(tree.size(), 8);
+        EXPECT_EQ(tree.root(), committed_root);
+
+        // The store remains usable after recovery
+        tree.add_values(std::vector<fr>(values.begin() + 8, values.end()));
+        EXPECT_EQ(store.commit(), 2);
+    }
+
+    // So is a record header cut short, or an append whose data never reached the disk
+    {
+        std::ofstream file(path, std::ios::binary | std::ios::app);
+        file << "a header cut short";
+    }
+    EXPECT_EQ(PersistentStore(path, depth).version(), 2);
+    {
+        std::ofstream file(path, std::ios::binary | std::ios::app);
+        file << std::string(4096, '\0');
+    }
+    const auto size = std::filesystem::file_size(path);
+    PersistentStore store(path, depth);
+    EXPECT_EQ(store.version(), 2);
+    EXPECT_EQ(store.leaf_count(), 16);
+    EXPECT_EQ(std::filesystem::file_size(path), size - 4096);
+}
+
+/**
+ * @brief A record whose header claims a payload larger than the rest of the file is taken for a torn append, without
+ * allocating for it
+ *
+ */
+TEST_F(PersistentStoreTests, OversizedRecordIsDropped)
+{
+    constexpr size_t depth = 8;
+    {
+        PersistentStore store(path, depth);
+        AppendOnlyTree<PersistentStore, HashPolicy> tree(store, depth);
+        tree.add_values(random_values(8));
+        store.commit();
+    }
+
+    // A record header (magic, version, number of entries, payload size) with a huge payload size, and a valid FNV-1a
+    // checksum over it
+    std::array<uint64_t, 5> header{ 0x44524345524b4d42, 2, 1, uint64_t(1) << 62, 0xcbf29ce484222325 };
+    for (const uint8_t byte : std::span(reinterpret_cast<const uint8_t*>(header.data()), 4 * sizeof(uint64_t))) {
+        header[4] = (header[4] ^ byte) * 0x100000001b3;
+    }
+    {
+        std::ofstream file(path, std::ios::binary | std::ios::app);
+        file.write(reinterpret_cast<const char*>(header.data()), sizeof(header));
+    }
+    PersistentStore store(path, depth);
+    EXPECT_EQ(store.version(), 1);
+    EXPECT_EQ(store.leaf_count(), 8);
+}
+
+/**
+ * @brief Damage anywhere but in the last record fails the opening of the store, rather than truncating committed
+ * transactions
+ *
+ */
+TEST_F(PersistentStoreTests, CorruptionIsReported)
+{
+    constexpr size_t depth = 8;
+    auto values = random_values(24);
+    {
+        PersistentStore store(path, depth);
+        AppendOnlyTree<PersistentStore, HashPolicy> tree(store, depth);
+        for (std::ptrdiff_t i = 0; i < 3; ++i) {
+            tree.add_values(std::vector<fr>(values.begin() + 8 * i, values.begin() + 8 * (i + 1)));
+            store.commit();
+        }
+    }
+
+    // The file header (16 bytes) is followed by the header of the first record (40 bytes) and its payload
+    for (const uint64_t offset : { uint64_t(16 + 24), uint64_t(16 + 40 + 100) }) {
+        char byte = 0;
+        {
+            std::ifstream file(path, std::ios::binary);
+            file.seekg(static_cast<std::streamoff>(offset));
+            file.get(byte);
+        }
+        const char flipped = static_cast<char>(byte ^ 1);
+        overwrite(path, offset, &flipped, 1);
+        EXPECT_ANY_THROW(PersistentStore(path, depth));
+        overwrite(path, offset, &byte, 1);
+    }
+
+    // A damaged record header after the last transaction cannot be told from a damaged transaction either
+    {
+        std::ofstream file(path, std::ios::binary | std::ios::app);
+        file << std::string(64, 'x');
+    }
+    EXPECT_ANY_THROW(PersistentStore(path, depth));
+    std::filesystem::resize_file(path, std::filesystem::file_size(path) - 64);
+    EXPECT_EQ(PersistentStore(path, depth).version(), 3);
+}
+
+/**
+ * @brief A store cannot be opened twice at once, as its commits would overwrite each other
+ *
+ */
+TEST_F(PersistentStoreTests, StoreIsLockedWhileOpen)
+{
+    constexpr size_t depth = 8;
+    {
+        PersistentStore store(path, depth);
+        EXPECT_ANY_THROW(PersistentStore(path, depth));
+    }
+    PersistentStore store(path, depth);
+    EXPECT_EQ(store.version(), 0);
+}
+
+/**
+ * @brief Snapshots serve the tree as of an earlier commit
+ *
+ */
+TEST_F(PersistentStoreTests, Snapshots)
+{
+    constexpr size_t depth = 10;
+    auto values = random_values(48);
+
+    PersistentStore store(path, depth);
+    AppendOnlyTree<PersistentStore, HashPolicy> tree(store, depth);
+    tree.add_values(std::vector<fr>(values.begin(), values.begin() + 16));
+    const uint64_t first_version = store.commit();
+    const fr first_root = tree.root();
+    const fr_hash_path first_path = tree.get_hash_path(3);
+
+    tree.add_values(std::vector<fr>(values.begin() + 16, values.end()));
+    store.commit();
+    EXPECT_NE(tree.root(), first_root);
+
+    auto snapshot = store.snapshot(first_version);
+    AppendOnlyTree<PersistentStore::Snapshot, HashPolicy> snapshot_tree(snapshot, depth);
+    EXPECT_EQ(snapshot_tree.size(), 16);
+    EXPECT_EQ(snapshot_tree.root(), first_root);
+    EXPECT_EQ(snapshot_tree.get_hash_path(3), first_path);
+}
+
+/**
+ * @brief An indexed tree with its leaves persisted alongside its nodes resumes from them, and continues to match a tree
+ * that was never reopened
+ *
+ */
+TEST_F(PersistentStoreTests, IndexedTreeSurvivesReopening)
+{
+    constexpr size_t depth = 10;
+    constexpr size_t batch_size = 16;
+
+    ArrayStore array_store(depth);
+    IndexedTree<ArrayStore, LeavesCache, HashPolicy> reference(array_store, depth, batch_size);
+    using Tree = IndexedTree<PersistentStore, PersistentLeavesStore, HashPolicy>;
+
+    auto first_batch = random_values(batch_size);
+    auto second_batch = random_values(batch_size);
+    reference.add_or_update_values(first_batch);
+    {
+        PersistentStore store(path, depth);
+        PersistentLeavesStore leaves(store, depth);
+        Tree tree(store, std::move(leaves), depth, batch_size);
+        tree.add_or_update_values(first_batch);
+        store.commit();
+
+        // Rolled back along with the nodes
+        tree.add_or_update_values(second_batch);
+    }
+
+    PersistentStore store(path, depth);
+    PersistentLeavesStore leaves(store, depth);
+    Tree tree(store, std::move(leaves), depth, batch_size);
+    EXPECT_EQ(tree.root(), reference.root());
+    for (size_t i = 0; i < 2 * batch_size; ++i) {
+        EXPECT_EQ(tree.get_leaf(i), reference.get_leaf(i));
+    }
+
+    EXPECT_EQ(tree.add_or_update_values(second_batch), reference.add_or_update_values(second_batch));
+    EXPECT_EQ(tree.root(), reference.root());
+    EXPECT_EQ(tree.get_hash_path(20), reference.get_hash_path(20));
+}
+
+/**
+ * @brief Compaction shrinks the file down to the latest state, which is kept across further commits and reopening,
+ * while the versions before it can no longer be read
+ *
+ */
+TEST_F(PersistentStoreTests, Compaction)
+{
+    constexpr size_t depth = 10;
+    auto values = random_values(80);
+
+    ArrayStore array_store(depth);
+    AppendOnlyTree<ArrayStore, HashPolicy> reference(array_store, depth);
+    reference.add_values(values);
+
+    uint64_t compacted_version = 0;
+    {
+        PersistentStore store(path, depth);
+        AppendOnlyTree<PersistentStore, HashPolicy> tree(store, depth);
+        // Most nodes above the leaves are rewritten by every commit
+        for (std::ptrdiff_t i = 0; i < 32; ++i) {
+            tree.add_values(std::vector<fr>(values.begin() + 2 * i, values.begin() + 2 * (i + 1)));
+            compacted_version = store.commit();
+        }
+        // Left uncommitted across the compaction
+        tree.add_values(std::vector<fr>(values.begin() + 64, values.begin() + 72));
+
+        const auto size = std::filesystem::file_size(path);
+        store.compact();
+        EXPECT_LT(std::filesystem::file_size(path), size / 2);
+        EXPECT_EQ(store.version(), compacted_version);
+        EXPECT_EQ(store.base_version(), compacted_version);
+        EXPECT_EQ(store.leaf_count(), 72);
+        EXPECT_ANY_THROW(store.snapshot(compacted_version - 1));
+        EXPECT_EQ(store.snapshot(compacted_version).leaf_count(), 64);
+
+        store.commit();
+        tree.add_values(std::vector<fr>(values.begin() + 72, values.end()));
+        store.commit();
+        EXPECT_EQ(tree.root(), reference.root());
+    }
+
+    PersistentStore store(path, depth);
+    AppendOnlyTree<PersistentStore, HashPolicy> tree(store, depth);
+    EXPECT_EQ(store.version(), compacted_version + 2);
+    EXPECT_EQ(store.base_version(), compacted_version);
+    EXPECT_EQ(store.snapshot(compacted_version).leaf_count(), 64);
+    EXPECT_EQ(tree.size(), 80);
+    EXPECT_EQ(tree.root(), reference.root());
+    EXPECT_EQ(tree.get_hash_path(42), reference.get_hash_path(42));
+}
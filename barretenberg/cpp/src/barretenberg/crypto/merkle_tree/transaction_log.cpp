@@ -0,0 +1,372 @@
+#include "transaction_log.hpp"
+#include "barretenberg/common/throw_or_abort.hpp"
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <fcntl.h>
+#include <filesystem>
+#include <sys/file.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <utility>
+
+namespace bb::crypto::merkle_tree {
+
+namespace {
+struct FileHeader {
+    static constexpr uint64_t MAGIC = 0x474f4c54524b4d42; // "BMKRTLOG"
+    static constexpr uint64_t FORMAT_VERSION = 2;
+
+    uint64_t magic;
+    uint64_t format_version;
+};
+
+struct RecordHeader {
+    static constexpr uint64_t MAGIC = 0x44524345524b4d42;            // "BMKRECRD"
+    static constexpr uint64_t CHECKPOINT_MAGIC = 0x54504b48434b4d42; // "BMKCHKPT"
+
+    uint64_t magic;
+    uint64_t version;
+    uint64_t num_entries;
+    uint64_t payload_size;
+    // Covers the fields above, so that the size of a record can be trusted before the record has been read
+    uint64_t header_checksum;
+};
+
+struct EntryHeader {
+    uint32_t key_size;
+    uint32_t value_size;
+};
+
+using Checksum = uint64_t;
+
+/**
+ * @brief 64-bit FNV-1a, extended over successive buffers by passing the previous result as hash
+ */
+Checksum fnv1a(const uint8_t* data, size_t size, Checksum hash = 0xcbf29ce484222325)
+{
+    for (size_t i = 0; i < size; ++i) {
+        hash ^= data[i];
+        hash *= 0x100000001b3;
+    }
+    return hash;
+}
+
+bool read_all(int fd, uint8_t* data, size_t size, uint64_t offset)
+{
+    while (size > 0) {
+        ssize_t num_read = ::pread(fd, data, size, static_cast<off_t>(offset));
+        if (num_read <= 0) {
+            return false;
+        }
+        data += num_read;
+        size -= static_cast<size_t>(num_read);
+        offset += static_cast<uint64_t>(num_read);
+    }
+    return true;
+}
+
+bool write_all(int fd, const uint8_t* data, size_t size, uint64_t offset)
+{
+    while (size > 0) {
+        ssize_t written = ::pwrite(fd, data, size, static_cast<off_t>(offset));
+        if (written <= 0) {
+            return false;
+        }
+        data += written;
+        size -= static_cast<size_t>(written);
+        offset += static_cast<uint64_t>(written);
+    }
+    return true;
+}
+
+Checksum header_checksum(const RecordHeader& header)
+{
+    return fnv1a(reinterpret_cast<const uint8_t*>(&header), offsetof(RecordHeader, header_checksum));
+}
+
+/**
+ * @brief Whether the file holds nothing but zeros from the given offset on, as it does where an append was cut short
+ * before its data reached the disk
+ */
+bool is_zero_filled(int fd, uint64_t offset, uint64_t file_size)
+{
+    std::vector<uint8_t> buffer(4096);
+    while (offset < file_size) {
+        const size_t size = static_cast<size_t>(std::min<uint64_t>(buffer.size(), file_size - offset));
+        if (!read_all(fd, buffer.data(), size, offset) ||
+            std::any_of(buffer.begin(), buffer.begin() + static_cast<std::ptrdiff_t>(size), [](uint8_t byte) {
+                return byte != 0;
+            })) {
+            return false;
+        }
+        offset += size;
+    }
+    return true;
+}
+
+/**
+ * @brief Serialise a record of the given entries, to be written at record_offset in the file
+ */
+std::vector<uint8_t> encode_record(uint64_t magic,
+                                   uint64_t version,
+                                   const std::vector<TransactionLog::Entry>& entries,
+                                   uint64_t record_offset,
+                                   std::vector<uint64_t>& value_offsets)
+{
+    size_t payload_size = 0;
+    for (const auto& entry : entries) {
+        payload_size += sizeof(EntryHeader) + entry.key.size() + entry.value.size();
+    }
+
+    RecordHeader header{ magic, version, entries.size(), payload_size, 0 };
+    header.header_checksum = header_checksum(header);
+    std::vector<uint8_t> record(sizeof(header) + payload_size + sizeof(Checksum));
+    std::memcpy(record.data(), &header, sizeof(header));
+
+    value_offsets.resize(entries.size());
+    size_t position = sizeof(header);
+    for (size_t i = 0; i < entries.size(); ++i) {
+        const auto& entry = entries[i];
+        const EntryHeader entry_header{ static_cast<uint32_t>(entry.key.size()),
+                                        static_cast<uint32_t>(entry.value.size()) };
+        std::memcpy(record.data() + position, &entry_header, sizeof(entry_header));
+        position += sizeof(entry_header);
+        std::memcpy(record.data() + position, entry.key.data(), entry.key.size());
+        position += entry.key.size();
+        std::memcpy(record.data() + position, entry.value.data(), entry.value.size());
+        value_offsets[i] = record_offset + position;
+        position += entry.value.size();
+    }
+    const Checksum checksum = fnv1a(record.data(), position);
+    std::memcpy(record.data() + position, &checksum, sizeof(checksum));
+    return record;
+}
+
+bool sync_directory_of(const std::string& path)
+{
+    std::filesystem::path directory = std::filesystem::path(path).parent_path();
+    if (directory.empty()) {
+        directory = ".";
+    }
+    const int fd = ::open(directory.c_str(), O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+    if (fd < 0) {
+        return false;
+    }
+    const bool synced = ::fsync(fd) == 0;
+    ::close(fd);
+    return synced;
+}
+} // namespace
+
+TransactionLog::TransactionLog(const std::string& path)
+    : path_(path)
+{
+    fd_ = ::open(path.c_str(), O_RDWR | O_CREAT | O_CLOEXEC, 0644);
+    if (fd_ < 0) {
+        throw_or_abort("TransactionLog: unable to open " + path);
+    }
+    // Appends from two logs over the same file would overwrite each other
+    if (::flock(fd_, LOCK_EX | LOCK_NB) != 0) {
+        ::close(std::exchange(fd_, -1));
+        throw_or_abort("TransactionLog: " + path + " is already open");
+    }
+}
+
+TransactionLog::TransactionLog(const std::string& path, const ReplayCallback& replay_callback)
+    : TransactionLog(path)
+{
+    struct stat st;
+    if (::fstat(fd_, &st) != 0) {
+        throw_or_abort("TransactionLog: unable to stat " + path);
+    }
+
+    // A new file, or one whose creation was interrupted before its header was flushed
+    if (static_cast<size_t>(st.st_size) < sizeof(FileHeader)) {
+        const FileHeader header{ FileHeader::MAGIC, FileHeader::FORMAT_VERSION };
+        if (::ftruncate(fd_, 0) != 0 ||
+            !write_all(fd_, reinterpret_cast<const uint8_t*>(&header), sizeof(header), 0) || ::fsync(fd_) != 0) {
+            throw_or_abort("TransactionLog: unable to initialise " + path);
+        }
+        end_ = sizeof(header);
+        return;
+    }
+
+    FileHeader header;
+    if (!read_all(fd_, reinterpret_cast<uint8_t*>(&header), sizeof(header), 0) || header.magic != FileHeader::MAGIC ||
+        header.format_version != FileHeader::FORMAT_VERSION) {
+        throw_or_abort("TransactionLog: " + path + " is not a transaction log");
+    }
+    replay(replay_callback, static_cast<uint64_t>(st.st_size));
+
+    // Discard the remains of a transaction that was being written when the process stopped
+    if (static_cast<uint64_t>(st.st_size) > end_) {
+        if (::ftruncate(fd_, static_cast<off_t>(end_)) != 0 || ::fsync(fd_) != 0) {
+            throw_or_abort("TransactionLog: unable to truncate " + path);
+        }
+    }
+}
+
+TransactionLog::TransactionLog(TransactionLog&& other) noexcept
+    : path_(std::move(other.path_))
+    , fd_(std::exchange(other.fd_, -1))
+    , end_(other.end_)
+    , version_(other.version_)
+    , base_version_(other.base_version_)
+{}
+
+TransactionLog& TransactionLog::operator=(TransactionLog&& other) noexcept
+{
+    path_ = std::move(other.path_);
+    std::swap(fd_, other.fd_);
+    end_ = other.end_;
+    version_ = other.version_;
+    base_version_ = other.base_version_;
+    return *this;
+}
+
+TransactionLog::~TransactionLog()
+{
+    if (fd_ >= 0) {
+        ::close(fd_);
+    }
+}
+
+void TransactionLog::replay(const ReplayCallback& callback, uint64_t file_size)
+{
+    struct ParsedEntry {
+        std::span<const uint8_t> key;
+        std::span<const uint8_t> value;
+        uint64_t value_offset;
+    };
+    const auto corrupted = [&](uint64_t offset) {
+        throw_or_abort("TransactionLog: " + path_ + " is corrupted at offset " + std::to_string(offset));
+    };
+
+    uint64_t offset = sizeof(FileHeader);
+    std::vector<uint8_t> payload;
+    std::vector<ParsedEntry> entries;
+    while (offset < file_size) {
+        // A header cut short can only be the start of an interrupted append
+        RecordHeader header;
+        if (file_size - offset < sizeof(header)) {
+            break;
+        }
+        if (!read_all(fd_, reinterpret_cast<uint8_t*>(&header), sizeof(header), offset)) {
+            throw_or_abort("TransactionLog: unable to read " + path_);
+        }
+        if (header.header_checksum != header_checksum(header)) {
+            if (is_zero_filled(fd_, offset, file_size)) {
+                break;
+            }
+            corrupted(offset);
+        }
+        // Only the first record of the file may be a checkpoint, which can hold any version
+        const bool is_checkpoint = header.magic == RecordHeader::CHECKPOINT_MAGIC && offset == sizeof(FileHeader);
+        if (!(header.magic == RecordHeader::MAGIC && header.version == version_ + 1) &&
+            !(is_checkpoint && header.version > 0)) {
+            corrupted(offset);
+        }
+
+        // A record running past the end of the file is the one being appended when the process stopped
+        Checksum checksum = 0;
+        const uint64_t payload_offset = offset + sizeof(header);
+        const uint64_t remaining = file_size - payload_offset;
+        if (remaining < sizeof(checksum) || header.payload_size > remaining - sizeof(checksum)) {
+            break;
+        }
+        const uint64_t record_end = payload_offset + header.payload_size + sizeof(checksum);
+        payload.resize(header.payload_size);
+        if (!read_all(fd_, payload.data(), payload.size(), payload_offset) ||
+            !read_all(fd_, reinterpret_cast<uint8_t*>(&checksum), sizeof(checksum), payload_offset + payload.size())) {
+            throw_or_abort("TransactionLog: unable to read " + path_);
+        }
+
+        // The checksum rules out torn writes, the bounds checks guard against a corrupted file
+        entries.clear();
+        size_t position = 0;
+        bool well_formed = checksum == fnv1a(payload.data(),
+                                             payload.size(),
+                                             fnv1a(reinterpret_cast<const uint8_t*>(&header), sizeof(header)));
+        for (uint64_t i = 0; i < header.num_entries && well_formed; ++i) {
+            EntryHeader entry_header;
+            well_formed = position + sizeof(entry_header) <= payload.size();
+            if (well_formed) {
+                std::memcpy(&entry_header, payload.data() + position, sizeof(entry_header));
+                position += sizeof(entry_header);
+                well_formed = position + entry_header.key_size + entry_header.value_size <= payload.size();
+            }
+            if (well_formed) {
+                const std::span<const uint8_t> key(payload.data() + position, entry_header.key_size);
+                position += entry_header.key_size;
+                const std::span<const uint8_t> value(payload.data() + position, entry_header.value_size);
+                entries.push_back({ key, value, payload_offset + position });
+                position += entry_header.value_size;
+            }
+        }
+        if (!well_formed || position != payload.size()) {
+            // The last record may have reached the disk only in part, any record before it was complete
+            if (record_end == file_size) {
+                break;
+            }
+            corrupted(offset);
+        }
+
+        for (const auto& entry : entries) {
+            callback(header.version, entry.key, entry.value, entry.value_offset);
+        }
+        if (is_checkpoint) {
+            base_version_ = header.version;
+        }
+        version_ = header.version;
+        offset = record_end;
+    }
+    end_ = offset;
+}
+
+uint64_t TransactionLog::append(const std::vector<Entry>& entries, std::vector<uint64_t>& value_offsets)
+{
+    const auto record = encode_record(RecordHeader::MAGIC, version_ + 1, entries, end_, value_offsets);
+    if (!write_all(fd_, record.data(), record.size(), end_) || ::fsync(fd_) != 0) {
+        throw_or_abort("TransactionLog: unable to write transaction");
+    }
+    end_ += record.size();
+    return ++version_;
+}
+
+void TransactionLog::checkpoint(const std::vector<Entry>& entries, std::vector<uint64_t>& value_offsets)
+{
+    // The checkpoint is written in full beside the log and then renamed over it, so that a crash leaves either file
+    // intact. Holding the log locked, no other process can be writing the same checkpoint.
+    const std::string checkpoint_path = path_ + ".checkpoint";
+    const int fd = ::open(checkpoint_path.c_str(), O_RDWR | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+    if (fd < 0) {
+        throw_or_abort("TransactionLog: unable to open " + checkpoint_path);
+    }
+
+    const FileHeader header{ FileHeader::MAGIC, FileHeader::FORMAT_VERSION };
+    const auto record = encode_record(RecordHeader::CHECKPOINT_MAGIC, version_, entries, sizeof(header), value_offsets);
+    if (::flock(fd, LOCK_EX | LOCK_NB) != 0 ||
+        !write_all(fd, reinterpret_cast<const uint8_t*>(&header), sizeof(header), 0) ||
+        !write_all(fd, record.data(), record.size(), sizeof(header)) || ::fsync(fd) != 0 ||
+        ::rename(checkpoint_path.c_str(), path_.c_str()) != 0) {
+        ::close(fd);
+        throw_or_abort("TransactionLog: unable to write checkpoint " + checkpoint_path);
+    }
+    ::close(std::exchange(fd_, fd));
+    end_ = sizeof(header) + record.size();
+    base_version_ = version_;
+
+    if (!sync_directory_of(path_)) {
+        throw_or_abort("TransactionLog: unable to sync the directory of " + path_);
+    }
+}
+
+void TransactionLog::read(uint64_t offset, uint8_t* data, size_t size) const
+{
+    if (!read_all(fd_, data, size, offset)) {
+        throw_or_abort("TransactionLog: unable to read value");
+    }
+}
+
+} // namespace bb::crypto::merkle_tree
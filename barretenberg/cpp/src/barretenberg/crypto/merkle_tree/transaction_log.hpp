@@ -0,0 +1,85 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <span>
+#include <string>
+#include <vector>
+
+namespace bb::crypto::merkle_tree {
+
+/**
+ * @brief A crash-safe, append-only log of write transactions, used as the backing file of the persistent tree stores
+ * @details Each transaction is appended to the file as a single record holding all of its (key, value) entries
+ * followed by a checksum, and is flushed to disk before append returns. A record only counts once it is complete, so a
+ * crash in the middle of a commit leaves the log in the state of the previous one: on opening, a torn record at the end
+ * of the file is truncated. Any other damage to the file is reported rather than repaired, since dropping an intact
+ * record past a corrupted one would silently lose committed transactions. Records are numbered with the version of the
+ * store they produce, starting from 1 (version 0 being the empty store).
+ *
+ * The log grows with every transaction until it is checkpointed: the file is then replaced by a single record holding
+ * the latest state, and the versions before it are no longer held.
+ *
+ * The file is locked for as long as the log is open, so it cannot be opened twice, by this process or another.
+ * @note Records are written in the byte order of the host, so the files are not portable across architectures.
+ */
+class TransactionLog {
+  public:
+    struct Entry {
+        std::vector<uint8_t> key;
+        std::vector<uint8_t> value;
+    };
+
+    // Invoked for each entry of each intact record when opening the log; value_offset locates the value in the file
+    using ReplayCallback = std::function<void(
+        uint64_t version, std::span<const uint8_t> key, std::span<const uint8_t> value, uint64_t value_offset)>;
+
+    TransactionLog(const std::string& path, const ReplayCallback& replay);
+    TransactionLog(const TransactionLog& other) = delete;
+    TransactionLog(TransactionLog&& other) noexcept;
+    TransactionLog& operator=(const TransactionLog& other) = delete;
+    TransactionLog& operator=(TransactionLog&& other) noexcept;
+    ~TransactionLog();
+
+    /**
+     * @brief Durably append a transaction, returning the new version
+     * @param value_offsets Populated with the offset in the file of the value of each entry
+     */
+    uint64_t append(const std::vector<Entry>& entries, std::vector<uint64_t>& value_offsets);
+
+    /**
+     * @brief Durably replace the log with a single record holding the given entries, which must be the complete state
+     * of the store at the current version
+     * @param value_offsets Populated with the offset in the new file of the value of each entry
+     */
+    void checkpoint(const std::vector<Entry>& entries, std::vector<uint64_t>& value_offsets);
+
+    /**
+     * @brief Read size bytes at the given offset of the file
+     */
+    void read(uint64_t offset, uint8_t* data, size_t size) const;
+
+    /**
+     * @brief Returns the version produced by the last committed transaction
+     */
+    uint64_t version() const { return version_; }
+
+    /**
+     * @brief Returns the oldest version whose state the log holds, i.e. that of the last checkpoint
+     */
+    uint64_t base_version() const { return base_version_; }
+
+  private:
+    // Opens and locks the file, so that the destructor releases it should replaying throw
+    explicit TransactionLog(const std::string& path);
+
+    void replay(const ReplayCallback& callback, uint64_t file_size);
+
+    std::string path_;
+    int fd_ = -1;
+    uint64_t end_ = 0;
+    uint64_t version_ = 0;
+    uint64_t base_version_ = 0;
+};
+
+} // namespace bb::crypto::merkle_tree
@@ -1,4 +1,6 @@
 #include "poseidon2.hpp"
+#include "barretenberg/common/assert.hpp"
+#include "barretenberg/common/thread.hpp"
 
 namespace bb::crypto {
 /**
@@ -10,6 +12,42 @@ typename Poseidon2<Params>::FF Poseidon2<Params>::hash(const std::vector<typenam
     return Sponge::hash_fixed_length(input);
 }
 
+/**
+ * @brief Hashes many pairs of field elements, out[i] = hash({ left[i], right[i] })
+ */
+template <typename Params>
+void Poseidon2<Params>::hash_pairs(std::span<const FF> left, std::span<const FF> right, std::span<FF> out)
+{
+    ASSERT(left.size() == out.size() && right.size() == out.size());
+    using Permutation = Poseidon2Permutation<Params>;
+    using State = typename Permutation::State;
+
+    // Hashing two elements takes a single permutation of the sponge's initial state with the elements absorbed, the
+    // hash being the first element of its output (see FieldSponge::hash_internal)
+    const FF iv(uint256_t(2) << 64);
+    constexpr size_t NUM_LANES = 4;
+    constexpr size_t MIN_PAIRS_PER_THREAD = 16;
+    run_loop_in_parallel(
+        out.size(),
+        [&](size_t start, size_t end) {
+            std::array<State, NUM_LANES> states;
+            size_t i = start;
+            for (; i + NUM_LANES <= end; i += NUM_LANES) {
+                for (size_t lane = 0; lane < NUM_LANES; ++lane) {
+                    states[lane] = { left[i + lane], right[i + lane], FF(0), iv };
+                }
+                Permutation::permutation(states);
+                for (size_t lane = 0; lane < NUM_LANES; ++lane) {
+                    out[i + lane] = states[lane][0];
+                }
+            }
+            for (; i < end; ++i) {
+                out[i] = Permutation::permutation({ left[i], right[i], FF(0), iv })[0];
+            }
+        },
+        MIN_PAIRS_PER_THREAD);
+}
+
 /**
  * @brief Hashes vector of bytes by chunking it into 31 byte field elements and calling hash()
  * @details Slice function cuts out the required number of bytes from the byte vector
@@ -17,6 +17,12 @@ template <typename Params> class Poseidon2 {
      * @brief Hashes a vector of field elements
      */
     static FF hash(const std::vector<FF>& input);
+    /**
+     * @brief Hashes many pairs of field elements, out[i] = hash({ left[i], right[i] })
+     * @details Pairs are hashed in parallel, several at a time per thread (see Poseidon2Permutation::permutation), e.g.
+     * to compute a whole level of a merkle tree at once.
+     */
+    static void hash_pairs(std::span<const FF> left, std::span<const FF> right, std::span<FF> out);
     /**
      * @brief Hashes vector of bytes by chunking it into 31 byte field elements and calling hash()
      * @details Slice function cuts out the required number of bytes from the byte vector
@@ -64,3 +64,22 @@ TEST(Poseidon2, HashBufferConsistencyCheck)
     EXPECT_NE(result1, expected);
     EXPECT_EQ(result2, expected);
 }
+
+TEST(Poseidon2, HashPairsConsistencyCheck)
+{
+    // Enough pairs to exercise both the interleaved and the scalar paths on every thread
+    const size_t num_pairs = 1029;
+    std::vector<fr> left(num_pairs);
+    std::vector<fr> right(num_pairs);
+    for (size_t i = 0; i < num_pairs; ++i) {
+        left[i] = fr::random_element(&engine);
+        right[i] = fr::random_element(&engine);
+    }
+
+    std::vector<fr> out(num_pairs);
+    crypto::Poseidon2<crypto::Poseidon2Bn254ScalarFieldParams>::hash_pairs(left, right, out);
+
+    for (size_t i = 0; i < num_pairs; ++i) {
+        EXPECT_EQ(out[i], crypto::Poseidon2<crypto::Poseidon2Bn254ScalarFieldParams>::hash({ left[i], right[i] }));
+    }
+}
@@ -160,5 +160,48 @@ template <typename Params> class Poseidon2Permutation {
         }
         return current_state;
     }
+
+    /**
+     * @brief Applies the permutation to several independent states at once, in place
+     * @details Each step of the permutation is applied to all of the states before moving on to the next, so that the
+     * field multiplications of different states do not depend on each other and their latencies overlap. This is
+     * mostly felt in the internal rounds, where a single state would wait on one s-box at a time.
+     */
+    template <size_t num_states> static constexpr void permutation(std::array<State, num_states>& states)
+    {
+        for (auto& state : states) {
+            matrix_multiplication_external(state);
+        }
+
+        constexpr size_t rounds_f_beginning = rounds_f / 2;
+        for (size_t i = 0; i < rounds_f_beginning; ++i) {
+            for (auto& state : states) {
+                add_round_constants(state, round_constants[i]);
+                apply_sbox(state);
+                matrix_multiplication_external(state);
+            }
+        }
+
+        const size_t p_end = rounds_f_beginning + rounds_p;
+        for (size_t i = rounds_f_beginning; i < p_end; ++i) {
+            for (auto& state : states) {
+                state[0] += round_constants[i][0];
+            }
+            for (auto& state : states) {
+                apply_single_sbox(state[0]);
+            }
+            for (auto& state : states) {
+                matrix_multiplication_internal(state);
+            }
+        }
+
+        for (size_t i = p_end; i < NUM_ROUNDS; ++i) {
+            for (auto& state : states) {
+                add_round_constants(state, round_constants[i]);
+                apply_sbox(state);
+                matrix_multiplication_external(state);
+            }
+        }
+    }
 };
 } // namespace bb::crypto
@@ -364,6 +364,96 @@ TEST(fr, BatchInvert)
     }
 }
 
+TEST(fr, BatchArithmetic)
+{
+    // Not a multiple of the vector width, so that both the vectorised and the scalar path run
+    constexpr size_t n = 75;
+    constexpr uint256_t twice_modulus = fr::modulus + fr::modulus;
+    std::vector<fr> a(n);
+    std::vector<fr> b(n);
+    for (size_t i = 0; i < n; ++i) {
+        a[i] = fr::random_element();
+        b[i] = fr::random_element();
+    }
+    // Edge cases of the coarse [0, 2p) representation
+    const fr largest{ twice_modulus.data[0] - 1, twice_modulus.data[1], twice_modulus.data[2], twice_modulus.data[3] };
+    a[0] = largest;
+    b[0] = largest;
+    a[1] = 0;
+    b[2] = fr{ fr::modulus.data[0], fr::modulus.data[1], fr::modulus.data[2], fr::modulus.data[3] };
+    const fr scalar = fr::random_element();
+
+    auto check = [&](const std::vector<fr>& result, auto expected) {
+        for (size_t i = 0; i < n; ++i) {
+            EXPECT_EQ(result[i], expected(i));
+            EXPECT_LT(result[i].uint256_t_no_montgomery_conversion(), twice_modulus);
+        }
+    };
+    std::vector<fr> result(n);
+    fr::batch_add(result, a, b);
+    check(result, [&](size_t i) { return a[i] + b[i]; });
+    fr::batch_sub(result, a, b);
+    check(result, [&](size_t i) { return a[i] - b[i]; });
+    fr::batch_mul(result, a, b);
+    check(result, [&](size_t i) { return a[i] * b[i]; });
+    fr::batch_mul(result, a, scalar);
+    check(result, [&](size_t i) { return a[i] * scalar; });
+    fr::batch_mul(result, a, largest);
+    check(result, [&](size_t i) { return a[i] * largest; });
+    fr::batch_sqr(result, a);
+    check(result, [&](size_t i) { return a[i].sqr(); });
+
+    // In place
+    result = a;
+    fr::batch_mul(result, result, b);
+    check(result, [&](size_t i) { return a[i] * b[i]; });
+}
+
+TEST(fr, BatchButterflyAndFold)
+{
+    constexpr size_t n = 43;
+    std::vector<fr> lo(n);
+    std::vector<fr> hi(n);
+    std::vector<fr> twiddles(n);
+    for (size_t i = 0; i < n; ++i) {
+        lo[i] = fr::random_element();
+        hi[i] = fr::random_element();
+        twiddles[i] = fr::random_element();
+    }
+    std::vector<fr> expected_lo(n);
+    std::vector<fr> expected_hi(n);
+    for (size_t i = 0; i < n; ++i) {
+        expected_lo[i] = lo[i] + twiddles[i] * hi[i];
+        expected_hi[i] = lo[i] - twiddles[i] * hi[i];
+    }
+    fr::batch_butterfly(lo, hi, twiddles);
+    EXPECT_EQ(lo, expected_lo);
+    EXPECT_EQ(hi, expected_hi);
+
+    std::vector<fr> evaluations(2 * n);
+    for (auto& evaluation : evaluations) {
+        evaluation = fr::random_element();
+    }
+    const fr challenge = fr::random_element();
+    std::vector<fr> expected(n);
+    for (size_t i = 0; i < n; ++i) {
+        expected[i] = evaluations[2 * i] + challenge * (evaluations[2 * i + 1] - evaluations[2 * i]);
+    }
+    std::vector<fr> folded(n);
+    fr::batch_fold(folded, evaluations, challenge);
+    EXPECT_EQ(folded, expected);
+
+    // In place, with the output starting inside the input as when folding an active range of a polynomial
+    const size_t offset = 5;
+    std::vector<fr> in_place = evaluations;
+    fr::batch_fold(std::span{ in_place }.subspan(offset, n - offset),
+                   std::span<const fr>{ in_place }.subspan(2 * offset, 2 * (n - offset)),
+                   challenge);
+    for (size_t i = offset; i < n; ++i) {
+        EXPECT_EQ(in_place[i], expected[i]);
+    }
+}
+
 TEST(fr, MultiplicativeGenerator)
 {
     EXPECT_EQ(fr::multiplicative_generator(), fr(5));
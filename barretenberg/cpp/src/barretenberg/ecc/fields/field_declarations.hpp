@@ -325,6 +325,19 @@ template <class Params_> struct alignas(32) field {
     constexpr field invert() const noexcept;
     static void batch_invert(std::span<field> coeffs) noexcept;
     static void batch_invert(field* coeffs, size_t n) noexcept;
+
+    // Element-wise operations over spans of equal size, eight elements at a time with AVX-512 IFMA when the CPU has it
+    // (see \ref field_docs_batched_ifma). The output may alias an input but must not partially overlap one.
+    static void batch_add(std::span<field> out, std::span<const field> a, std::span<const field> b) noexcept;
+    static void batch_sub(std::span<field> out, std::span<const field> a, std::span<const field> b) noexcept;
+    static void batch_mul(std::span<field> out, std::span<const field> a, std::span<const field> b) noexcept;
+    static void batch_mul(std::span<field> out, std::span<const field> a, const field& b) noexcept;
+    static void batch_sqr(std::span<field> out, std::span<const field> a) noexcept;
+    // FFT butterfly: (lo[i], hi[i]) <- (lo[i] + twiddles[i] ⋅ hi[i], lo[i] - twiddles[i] ⋅ hi[i])
+    static void batch_butterfly(std::span<field> lo, std::span<field> hi, std::span<const field> twiddles) noexcept;
+    // Multilinear folding: out[i] <- in[2i] + challenge ⋅ (in[2i + 1] - in[2i]). out may overlap in if it does not
+    // start after it.
+    static void batch_fold(std::span<field> out, std::span<const field> in, const field& challenge) noexcept;
     /**
      * @brief Compute square root of the field element.
      *
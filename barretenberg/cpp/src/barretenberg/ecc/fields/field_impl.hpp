@@ -10,6 +10,7 @@
 #include <vector>
 
 #include "./field_declarations.hpp"
+#include "./field_impl_ifma.hpp"
 
 namespace bb {
 
@@ -452,6 +453,156 @@ template <class T> void field<T>::batch_invert(std::span<field> coeffs) noexcept
     }
 }
 
+// NOLINTBEGIN(cppcoreguidelines-pro-type-reinterpret-cast)
+/**
+ * @brief Number of leading elements of a batched operation handled by the AVX-512 IFMA kernels, the rest is left to the
+ * scalar loop
+ */
+template <class T> inline size_t ifma_batch_prefix([[maybe_unused]] const size_t n) noexcept
+{
+#if BB_FIELD_IFMA
+    if constexpr (field_ifma::is_applicable<T>) {
+        if (field_ifma::is_supported()) {
+            return n - (n % field_ifma::LANES);
+        }
+    }
+#endif
+    return 0;
+}
+
+template <class T>
+void field<T>::batch_add(std::span<field> out, std::span<const field> a, std::span<const field> b) noexcept
+{
+    BB_OP_COUNT_TRACK_NAME("fr::batch_add");
+    ASSERT(a.size() == out.size() && b.size() == out.size());
+    size_t i = ifma_batch_prefix<T>(out.size());
+#if BB_FIELD_IFMA
+    if (i != 0) {
+        field_ifma::add<T>(reinterpret_cast<uint64_t*>(out.data()),
+                           reinterpret_cast<const uint64_t*>(a.data()),
+                           reinterpret_cast<const uint64_t*>(b.data()),
+                           i / field_ifma::LANES);
+    }
+#endif
+    for (; i < out.size(); ++i) {
+        out[i] = a[i] + b[i];
+    }
+}
+
+template <class T>
+void field<T>::batch_sub(std::span<field> out, std::span<const field> a, std::span<const field> b) noexcept
+{
+    BB_OP_COUNT_TRACK_NAME("fr::batch_sub");
+    ASSERT(a.size() == out.size() && b.size() == out.size());
+    size_t i = ifma_batch_prefix<T>(out.size());
+#if BB_FIELD_IFMA
+    if (i != 0) {
+        field_ifma::sub<T>(reinterpret_cast<uint64_t*>(out.data()),
+                           reinterpret_cast<const uint64_t*>(a.data()),
+                           reinterpret_cast<const uint64_t*>(b.data()),
+                           i / field_ifma::LANES);
+    }
+#endif
+    for (; i < out.size(); ++i) {
+        out[i] = a[i] - b[i];
+    }
+}
+
+template <class T>
+void field<T>::batch_mul(std::span<field> out, std::span<const field> a, std::span<const field> b) noexcept
+{
+    BB_OP_COUNT_TRACK_NAME("fr::batch_mul");
+    ASSERT(a.size() == out.size() && b.size() == out.size());
+    size_t i = ifma_batch_prefix<T>(out.size());
+#if BB_FIELD_IFMA
+    if (i != 0) {
+        field_ifma::mul<T>(reinterpret_cast<uint64_t*>(out.data()),
+                           reinterpret_cast<const uint64_t*>(a.data()),
+                           reinterpret_cast<const uint64_t*>(b.data()),
+                           i / field_ifma::LANES);
+    }
+#endif
+    for (; i < out.size(); ++i) {
+        out[i] = a[i] * b[i];
+    }
+}
+
+template <class T> void field<T>::batch_mul(std::span<field> out, std::span<const field> a, const field& b) noexcept
+{
+    BB_OP_COUNT_TRACK_NAME("fr::batch_mul_by_scalar");
+    ASSERT(a.size() == out.size());
+    size_t i = ifma_batch_prefix<T>(out.size());
+#if BB_FIELD_IFMA
+    if (i != 0) {
+        field_ifma::mul_by_scalar<T>(reinterpret_cast<uint64_t*>(out.data()),
+                                     reinterpret_cast<const uint64_t*>(a.data()),
+                                     &b.data[0],
+                                     i / field_ifma::LANES);
+    }
+#endif
+    for (; i < out.size(); ++i) {
+        out[i] = a[i] * b;
+    }
+}
+
+template <class T> void field<T>::batch_sqr(std::span<field> out, std::span<const field> a) noexcept
+{
+    BB_OP_COUNT_TRACK_NAME("fr::batch_sqr");
+    ASSERT(a.size() == out.size());
+    size_t i = ifma_batch_prefix<T>(out.size());
+#if BB_FIELD_IFMA
+    if (i != 0) {
+        field_ifma::sqr<T>(reinterpret_cast<uint64_t*>(out.data()),
+                           reinterpret_cast<const uint64_t*>(a.data()),
+                           i / field_ifma::LANES);
+    }
+#endif
+    for (; i < out.size(); ++i) {
+        out[i] = a[i].sqr();
+    }
+}
+
+template <class T>
+void field<T>::batch_butterfly(std::span<field> lo, std::span<field> hi, std::span<const field> twiddles) noexcept
+{
+    BB_OP_COUNT_TRACK_NAME("fr::batch_butterfly");
+    ASSERT(hi.size() == lo.size() && twiddles.size() == lo.size());
+    size_t i = ifma_batch_prefix<T>(lo.size());
+#if BB_FIELD_IFMA
+    if (i != 0) {
+        field_ifma::butterfly<T>(reinterpret_cast<uint64_t*>(lo.data()),
+                                 reinterpret_cast<uint64_t*>(hi.data()),
+                                 reinterpret_cast<const uint64_t*>(twiddles.data()),
+                                 i / field_ifma::LANES);
+    }
+#endif
+    for (; i < lo.size(); ++i) {
+        const field temp = twiddles[i] * hi[i];
+        hi[i] = lo[i] - temp;
+        lo[i] += temp;
+    }
+}
+
+template <class T>
+void field<T>::batch_fold(std::span<field> out, std::span<const field> in, const field& challenge) noexcept
+{
+    BB_OP_COUNT_TRACK_NAME("fr::batch_fold");
+    ASSERT(in.size() == 2 * out.size());
+    size_t i = ifma_batch_prefix<T>(out.size());
+#if BB_FIELD_IFMA
+    if (i != 0) {
+        field_ifma::fold<T>(reinterpret_cast<uint64_t*>(out.data()),
+                            reinterpret_cast<const uint64_t*>(in.data()),
+                            &challenge.data[0],
+                            i / field_ifma::LANES);
+    }
+#endif
+    for (; i < out.size(); ++i) {
+        out[i] = in[2 * i] + challenge * (in[2 * i + 1] - in[2 * i]);
+    }
+}
+// NOLINTEND(cppcoreguidelines-pro-type-reinterpret-cast)
+
 template <class T> constexpr field<T> field<T>::tonelli_shanks_sqrt() const noexcept
 {
     BB_OP_COUNT_TRACK_NAME("fr::tonelli_shanks_sqrt");
@@ -0,0 +1,411 @@
+#pragma once
+
+/**
+ * @brief AVX-512 IFMA kernels behind the batched span operations of field (field::batch_mul and friends)
+ *
+ * @details See \ref field_docs_batched_ifma "the field documentation" for the representation. The kernels are compiled
+ * for AVX-512 IFMA through function attributes only, so that the rest of the library keeps its baseline target. Callers
+ * must check is_supported() and is_applicable<Params> before calling any of them.
+ */
+#include "./field_declarations.hpp"
+
+#if defined(__x86_64__) && !defined(__wasm__) && !defined(DISABLE_ASM)
+#define BB_FIELD_IFMA 1
+#else
+#define BB_FIELD_IFMA 0
+#endif
+
+#if BB_FIELD_IFMA
+// GCC 12 reports the _mm512_undefined_epi32() operand of the unmasked AVX-512 shift intrinsics as uninitialized (GCC
+// PR105593), both in the header and where the kernels inline them
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wuninitialized"
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+#endif
+#include <immintrin.h>
+
+#define BB_IFMA_TARGET __attribute__((target("avx512f,avx512ifma")))
+#define BB_IFMA_INLINE __attribute__((target("avx512f,avx512ifma"), always_inline)) inline
+
+// NOLINTBEGIN(cppcoreguidelines-avoid-c-arrays)
+namespace bb::field_ifma {
+
+// Field elements per vector
+constexpr size_t LANES = 8;
+constexpr uint64_t LIMB_MASK_52 = (1ULL << 52) - 1;
+
+inline bool is_supported() noexcept
+{
+    static const bool supported = __builtin_cpu_supports("avx512f") != 0 && __builtin_cpu_supports("avx512ifma") != 0;
+    return supported;
+}
+
+/**
+ * @brief The kernels rely on the coarse [0, 2p) representation of moduli below 2²⁵⁴
+ */
+template <class Params>
+constexpr bool is_applicable = (Params::modulus_3 < 0x4000000000000000ULL) &&
+                               !(Params::modulus_1 == 0 && Params::modulus_2 == 0 && Params::modulus_3 == 0);
+
+/**
+ * @brief Broadcast constants of the field
+ */
+struct Constants {
+    __m512i twice_modulus[4];
+    __m512i modulus_52[5];
+    __m512i r_inv_52;
+};
+
+template <class Params> BB_IFMA_INLINE Constants get_constants()
+{
+    constexpr uint64_t p0 = Params::modulus_0;
+    constexpr uint64_t p1 = Params::modulus_1;
+    constexpr uint64_t p2 = Params::modulus_2;
+    constexpr uint64_t p3 = Params::modulus_3;
+    Constants constants;
+    constants.twice_modulus[0] = _mm512_set1_epi64(static_cast<int64_t>(p0 << 1));
+    constants.twice_modulus[1] = _mm512_set1_epi64(static_cast<int64_t>((p1 << 1) | (p0 >> 63)));
+    constants.twice_modulus[2] = _mm512_set1_epi64(static_cast<int64_t>((p2 << 1) | (p1 >> 63)));
+    constants.twice_modulus[3] = _mm512_set1_epi64(static_cast<int64_t>((p3 << 1) | (p2 >> 63)));
+    constants.modulus_52[0] = _mm512_set1_epi64(static_cast<int64_t>(p0 & LIMB_MASK_52));
+    constants.modulus_52[1] = _mm512_set1_epi64(static_cast<int64_t>(((p0 >> 52) | (p1 << 12)) & LIMB_MASK_52));
+    constants.modulus_52[2] = _mm512_set1_epi64(static_cast<int64_t>(((p1 >> 40) | (p2 << 24)) & LIMB_MASK_52));
+    constants.modulus_52[3] = _mm512_set1_epi64(static_cast<int64_t>(((p2 >> 28) | (p3 << 36)) & LIMB_MASK_52));
+    constants.modulus_52[4] = _mm512_set1_epi64(static_cast<int64_t>(p3 >> 16));
+    // -p⁻¹ mod 2⁶⁴ truncates to -p⁻¹ mod 2⁵²
+    constants.r_inv_52 = _mm512_set1_epi64(static_cast<int64_t>(Params::r_inv & LIMB_MASK_52));
+    return constants;
+}
+
+/**
+ * @brief Load 8 consecutive field elements, transposed so that limbs[k] holds limb k of every element
+ */
+BB_IFMA_INLINE void load(const uint64_t* src, __m512i (&limbs)[4])
+{
+    const __m512i v0 = _mm512_loadu_si512(src);
+    const __m512i v1 = _mm512_loadu_si512(src + 8);
+    const __m512i v2 = _mm512_loadu_si512(src + 16);
+    const __m512i v3 = _mm512_loadu_si512(src + 24);
+    const __m512i low_limbs = _mm512_setr_epi64(0, 4, 8, 12, 1, 5, 9, 13);
+    const __m512i high_limbs = _mm512_setr_epi64(2, 6, 10, 14, 3, 7, 11, 15);
+    const __m512i first_half = _mm512_setr_epi64(0, 1, 2, 3, 8, 9, 10, 11);
+    const __m512i second_half = _mm512_setr_epi64(4, 5, 6, 7, 12, 13, 14, 15);
+    // Limbs 0 and 1 (resp. 2 and 3) of elements 0..3 and of elements 4..7
+    const __m512i t0 = _mm512_permutex2var_epi64(v0, low_limbs, v1);
+    const __m512i t1 = _mm512_permutex2var_epi64(v0, high_limbs, v1);
+    const __m512i t2 = _mm512_permutex2var_epi64(v2, low_limbs, v3);
+    const __m512i t3 = _mm512_permutex2var_epi64(v2, high_limbs, v3);
+    limbs[0] = _mm512_permutex2var_epi64(t0, first_half, t2);
+    limbs[1] = _mm512_permutex2var_epi64(t0, second_half, t2);
+    limbs[2] = _mm512_permutex2var_epi64(t1, first_half, t3);
+    limbs[3] = _mm512_permutex2var_epi64(t1, second_half, t3);
+}
+
+/**
+ * @brief Inverse of load
+ */
+BB_IFMA_INLINE void store(uint64_t* dst, const __m512i (&limbs)[4])
+{
+    const __m512i low_limbs = _mm512_setr_epi64(0, 4, 8, 12, 1, 5, 9, 13);
+    const __m512i high_limbs = _mm512_setr_epi64(2, 6, 10, 14, 3, 7, 11, 15);
+    const __m512i first_half = _mm512_setr_epi64(0, 1, 2, 3, 8, 9, 10, 11);
+    const __m512i second_half = _mm512_setr_epi64(4, 5, 6, 7, 12, 13, 14, 15);
+    const __m512i t0 = _mm512_permutex2var_epi64(limbs[0], first_half, limbs[1]);
+    const __m512i t1 = _mm512_permutex2var_epi64(limbs[2], first_half, limbs[3]);
+    const __m512i t2 = _mm512_permutex2var_epi64(limbs[0], second_half, limbs[1]);
+    const __m512i t3 = _mm512_permutex2var_epi64(limbs[2], second_half, limbs[3]);
+    _mm512_storeu_si512(dst, _mm512_permutex2var_epi64(t0, low_limbs, t1));
+    _mm512_storeu_si512(dst + 8, _mm512_permutex2var_epi64(t0, high_limbs, t1));
+    _mm512_storeu_si512(dst + 16, _mm512_permutex2var_epi64(t2, low_limbs, t3));
+    _mm512_storeu_si512(dst + 24, _mm512_permutex2var_epi64(t2, high_limbs, t3));
+}
+
+/**
+ * @brief Load 16 consecutive field elements and split them into the even and the odd ones
+ */
+BB_IFMA_INLINE void load_pairs(const uint64_t* src, __m512i (&evens)[4], __m512i (&odds)[4])
+{
+    __m512i first[4];
+    __m512i second[4];
+    load(src, first);
+    load(src + 32, second);
+    const __m512i even_lanes = _mm512_setr_epi64(0, 2, 4, 6, 8, 10, 12, 14);
+    const __m512i odd_lanes = _mm512_setr_epi64(1, 3, 5, 7, 9, 11, 13, 15);
+    for (size_t k = 0; k < 4; ++k) {
+        evens[k] = _mm512_permutex2var_epi64(first[k], even_lanes, second[k]);
+        odds[k] = _mm512_permutex2var_epi64(first[k], odd_lanes, second[k]);
+    }
+}
+
+/**
+ * @brief r = a + b over 4x64-bit limbs, returning the carry out of the top limb
+ */
+BB_IFMA_INLINE __mmask8 add_limbs(const __m512i (&a)[4], const __m512i (&b)[4], __m512i (&r)[4])
+{
+    const __m512i one = _mm512_set1_epi64(1);
+    const __m512i zero = _mm512_setzero_si512();
+    __mmask8 carry = 0;
+    for (size_t k = 0; k < 4; ++k) {
+        const __m512i sum = _mm512_add_epi64(a[k], b[k]);
+        const __mmask8 overflow = _mm512_cmplt_epu64_mask(sum, a[k]);
+        r[k] = _mm512_mask_add_epi64(sum, carry, sum, one);
+        carry = overflow | _mm512_mask_cmpeq_epi64_mask(carry, r[k], zero);
+    }
+    return carry;
+}
+
+/**
+ * @brief r = a - b over 4x64-bit limbs, returning the borrow out of the top limb
+ */
+BB_IFMA_INLINE __mmask8 sub_limbs(const __m512i (&a)[4], const __m512i (&b)[4], __m512i (&r)[4])
+{
+    const __m512i one = _mm512_set1_epi64(1);
+    const __m512i zero = _mm512_setzero_si512();
+    __mmask8 borrow = 0;
+    for (size_t k = 0; k < 4; ++k) {
+        const __m512i difference = _mm512_sub_epi64(a[k], b[k]);
+        const __mmask8 underflow = _mm512_cmplt_epu64_mask(a[k], b[k]);
+        r[k] = _mm512_mask_sub_epi64(difference, borrow, difference, one);
+        borrow = underflow | _mm512_mask_cmpeq_epi64_mask(borrow, difference, zero);
+    }
+    return borrow;
+}
+
+/**
+ * @brief Coarse addition, same as field::add: subtract 2p if a + b >= 2p
+ */
+BB_IFMA_INLINE void add(const Constants& constants, const __m512i (&a)[4], const __m512i (&b)[4], __m512i (&r)[4])
+{
+    __m512i sum[4];
+    __m512i reduced[4];
+    add_limbs(a, b, sum);
+    const __mmask8 below_twice_modulus = sub_limbs(sum, constants.twice_modulus, reduced);
+    for (size_t k = 0; k < 4; ++k) {
+        r[k] = _mm512_mask_blend_epi64(below_twice_modulus, reduced[k], sum[k]);
+    }
+}
+
+/**
+ * @brief Coarse subtraction, same as field::subtract_coarse: add 2p if a - b underflows
+ */
+BB_IFMA_INLINE void sub(const Constants& constants, const __m512i (&a)[4], const __m512i (&b)[4], __m512i (&r)[4])
+{
+    __m512i difference[4];
+    __m512i correction[4];
+    const __mmask8 underflow = sub_limbs(a, b, difference);
+    for (size_t k = 0; k < 4; ++k) {
+        correction[k] = _mm512_maskz_mov_epi64(underflow, constants.twice_modulus[k]);
+    }
+    add_limbs(difference, correction, r);
+}
+
+/**
+ * @brief Convert 4x64-bit limbs of a ⋅ 2^SHIFT to 5x52-bit limbs
+ */
+template <unsigned SHIFT> BB_IFMA_INLINE void to_radix_52(const __m512i (&a)[4], __m512i (&r)[5])
+{
+    const __m512i mask = _mm512_set1_epi64(static_cast<int64_t>(LIMB_MASK_52));
+    r[0] = _mm512_and_si512(_mm512_slli_epi64(a[0], SHIFT), mask);
+    r[1] = _mm512_and_si512(_mm512_or_si512(_mm512_srli_epi64(a[0], 52 - SHIFT), _mm512_slli_epi64(a[1], 12 + SHIFT)),
+                            mask);
+    r[2] = _mm512_and_si512(_mm512_or_si512(_mm512_srli_epi64(a[1], 40 - SHIFT), _mm512_slli_epi64(a[2], 24 + SHIFT)),
+                            mask);
+    r[3] = _mm512_and_si512(_mm512_or_si512(_mm512_srli_epi64(a[2], 28 - SHIFT), _mm512_slli_epi64(a[3], 36 + SHIFT)),
+                            mask);
+    r[4] = _mm512_srli_epi64(a[3], 16 - SHIFT);
+}
+
+/**
+ * @brief Convert normalised 5x52-bit limbs of a value below 2²⁵⁶ to 4x64-bit limbs
+ */
+BB_IFMA_INLINE void from_radix_52(const __m512i (&a)[5], __m512i (&r)[4])
+{
+    r[0] = _mm512_or_si512(a[0], _mm512_slli_epi64(a[1], 52));
+    r[1] = _mm512_or_si512(_mm512_srli_epi64(a[1], 12), _mm512_slli_epi64(a[2], 40));
+    r[2] = _mm512_or_si512(_mm512_srli_epi64(a[2], 24), _mm512_slli_epi64(a[3], 28));
+    r[3] = _mm512_or_si512(_mm512_srli_epi64(a[3], 36), _mm512_slli_epi64(a[4], 16));
+}
+
+/**
+ * @brief Montgomery multiplication over 5x52-bit limbs, r = a ⋅ b / 2²⁶⁰ mod p
+ * @details Operand scanning: each of the 5 rounds adds aᵢ ⋅ b and then m ⋅ p to zero out the lowest limb. The
+ * accumulators are only normalised once at the end, every round adds less than 2⁵⁴ to each of them.
+ */
+BB_IFMA_INLINE void montgomery_mul_52(const Constants& constants,
+                                      const __m512i (&a)[5],
+                                      const __m512i (&b)[5],
+                                      __m512i (&r)[5])
+{
+    const __m512i zero = _mm512_setzero_si512();
+    __m512i t[6] = { zero, zero, zero, zero, zero, zero };
+    for (size_t i = 0; i < 5; ++i) {
+        for (size_t j = 0; j < 5; ++j) {
+            t[j] = _mm512_madd52lo_epu64(t[j], a[i], b[j]);
+            t[j + 1] = _mm512_madd52hi_epu64(t[j + 1], a[i], b[j]);
+        }
+        const __m512i m = _mm512_madd52lo_epu64(zero, t[0], constants.r_inv_52);
+        for (size_t j = 0; j < 5; ++j) {
+            t[j] = _mm512_madd52lo_epu64(t[j], m, constants.modulus_52[j]);
+            t[j + 1] = _mm512_madd52hi_epu64(t[j + 1], m, constants.modulus_52[j]);
+        }
+        // The low 52 bits of t[0] are now zero, shift down by one limb
+        t[1] = _mm512_add_epi64(t[1], _mm512_srli_epi64(t[0], 52));
+        for (size_t j = 0; j < 5; ++j) {
+            t[j] = t[j + 1];
+        }
+        t[5] = zero;
+    }
+    const __m512i mask = _mm512_set1_epi64(static_cast<int64_t>(LIMB_MASK_52));
+    for (size_t j = 0; j < 4; ++j) {
+        t[j + 1] = _mm512_add_epi64(t[j + 1], _mm512_srli_epi64(t[j], 52));
+        r[j] = _mm512_and_si512(t[j], mask);
+    }
+    r[4] = t[4];
+}
+
+/**
+ * @brief Coarse Montgomery multiplication, r = a ⋅ b / 2²⁵⁶ mod p in [0, 2p)
+ * @details scaled_a holds a ⋅ 2⁴ in radix 2⁵², which fits in 5 limbs since a < 2p < 2²⁵⁵. Multiplying it by b with
+ * the radix-2⁵² Montgomery reduction divides by 2²⁶⁰, which leaves the division by 2²⁵⁶ of field::operator*.
+ */
+BB_IFMA_INLINE void mul(const Constants& constants,
+                        const __m512i (&scaled_a)[5],
+                        const __m512i (&b)[4],
+                        __m512i (&r)[4])
+{
+    __m512i b_52[5];
+    __m512i r_52[5];
+    to_radix_52<0>(b, b_52);
+    montgomery_mul_52(constants, scaled_a, b_52, r_52);
+    from_radix_52(r_52, r);
+}
+
+BB_IFMA_INLINE void mul(const Constants& constants, const __m512i (&a)[4], const __m512i (&b)[4], __m512i (&r)[4])
+{
+    __m512i scaled_a[5];
+    to_radix_52<4>(a, scaled_a);
+    mul(constants, scaled_a, b, r);
+}
+
+BB_IFMA_INLINE void broadcast_scaled(const uint64_t* element, __m512i (&r)[5])
+{
+    __m512i limbs[4];
+    for (size_t k = 0; k < 4; ++k) {
+        limbs[k] = _mm512_set1_epi64(static_cast<int64_t>(element[k]));
+    }
+    to_radix_52<4>(limbs, r);
+}
+
+template <class Params>
+BB_IFMA_TARGET void add(uint64_t* out, const uint64_t* a, const uint64_t* b, const size_t num_blocks) noexcept
+{
+    const Constants constants = get_constants<Params>();
+    for (size_t i = 0; i < num_blocks * LANES * 4; i += LANES * 4) {
+        __m512i x[4];
+        __m512i y[4];
+        load(a + i, x);
+        load(b + i, y);
+        add(constants, x, y, x);
+        store(out + i, x);
+    }
+}
+
+template <class Params>
+BB_IFMA_TARGET void sub(uint64_t* out, const uint64_t* a, const uint64_t* b, const size_t num_blocks) noexcept
+{
+    const Constants constants = get_constants<Params>();
+    for (size_t i = 0; i < num_blocks * LANES * 4; i += LANES * 4) {
+        __m512i x[4];
+        __m512i y[4];
+        load(a + i, x);
+        load(b + i, y);
+        sub(constants, x, y, x);
+        store(out + i, x);
+    }
+}
+
+template <class Params>
+BB_IFMA_TARGET void mul(uint64_t* out, const uint64_t* a, const uint64_t* b, const size_t num_blocks) noexcept
+{
+    const Constants constants = get_constants<Params>();
+    for (size_t i = 0; i < num_blocks * LANES * 4; i += LANES * 4) {
+        __m512i x[4];
+        __m512i y[4];
+        load(a + i, x);
+        load(b + i, y);
+        mul(constants, x, y, x);
+        store(out + i, x);
+    }
+}
+
+template <class Params>
+BB_IFMA_TARGET void mul_by_scalar(uint64_t* out, const uint64_t* a, const uint64_t* b, const size_t num_blocks) noexcept
+{
+    const Constants constants = get_constants<Params>();
+    __m512i scaled_b[5];
+    broadcast_scaled(b, scaled_b);
+    for (size_t i = 0; i < num_blocks * LANES * 4; i += LANES * 4) {
+        __m512i x[4];
+        load(a + i, x);
+        mul(constants, scaled_b, x, x);
+        store(out + i, x);
+    }
+}
+
+template <class Params> BB_IFMA_TARGET void sqr(uint64_t* out, const uint64_t* a, const size_t num_blocks) noexcept
+{
+    const Constants constants = get_constants<Params>();
+    for (size_t i = 0; i < num_blocks * LANES * 4; i += LANES * 4) {
+        __m512i x[4];
+        load(a + i, x);
+        mul(constants, x, x, x);
+        store(out + i, x);
+    }
+}
+
+template <class Params>
+BB_IFMA_TARGET void butterfly(uint64_t* lo, uint64_t* hi, const uint64_t* twiddles, const size_t num_blocks) noexcept
+{
+    const Constants constants = get_constants<Params>();
+    for (size_t i = 0; i < num_blocks * LANES * 4; i += LANES * 4) {
+        __m512i x[4];
+        __m512i y[4];
+        __m512i w[4];
+        load(lo + i, x);
+        load(hi + i, y);
+        load(twiddles + i, w);
+        mul(constants, w, y, w);
+        sub(constants, x, w, y);
+        add(constants, x, w, x);
+        store(lo + i, x);
+        store(hi + i, y);
+    }
+}
+
+template <class Params>
+BB_IFMA_TARGET void fold(uint64_t* out, const uint64_t* in, const uint64_t* challenge, const size_t num_blocks) noexcept
+{
+    const Constants constants = get_constants<Params>();
+    __m512i scaled_challenge[5];
+    broadcast_scaled(challenge, scaled_challenge);
+    for (size_t i = 0; i < num_blocks * LANES * 4; i += LANES * 4) {
+        __m512i evens[4];
+        __m512i odds[4];
+        load_pairs(in + 2 * i, evens, odds);
+        sub(constants, odds, evens, odds);
+        mul(constants, scaled_challenge, odds, odds);
+        add(constants, evens, odds, evens);
+        store(out + i, evens);
+    }
+}
+
+} // namespace bb::field_ifma
+// NOLINTEND(cppcoreguidelines-avoid-c-arrays)
+
+#undef BB_IFMA_TARGET
+#undef BB_IFMA_INLINE
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#endif
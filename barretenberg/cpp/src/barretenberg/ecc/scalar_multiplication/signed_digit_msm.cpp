@@ -0,0 +1,436 @@
+#include "./signed_digit_msm.hpp"
+#include "./scalar_multiplication.hpp"
+#include "./sorted_msm.hpp"
+#include "barretenberg/common/assert.hpp"
+#include "barretenberg/common/op_count.hpp"
+#include "barretenberg/common/thread.hpp"
+#include <algorithm>
+#include <array>
+#include <span>
+#include <vector>
+
+namespace bb::scalar_multiplication {
+
+namespace {
+// Bit length of the scalar halves produced by the endomorphism split
+constexpr size_t ENDO_SCALAR_BITS = 128;
+// Digits are stored as 16-bit |d| | (sign << 15), so |d| <= 2^{c-1} must fit in 15 bits
+constexpr size_t MIN_WINDOW_BITS = 2;
+constexpr size_t MAX_WINDOW_BITS = 15;
+constexpr uint16_t DIGIT_SIGN_BIT = 1U << 15;
+
+// Rough costs in field multiplications: a batch-affine addition (including its share of the batch inversion), and the
+// mixed plus full Jacobian addition that every bucket costs in the running-sum reduction
+constexpr size_t AFFINE_ADDITION_COST = 6;
+constexpr size_t BUCKET_REDUCTION_COST = 30;
+
+size_t get_num_windows(size_t window_bits)
+{
+    // One extra window absorbs the carry out of the top window of the recoding
+    return ENDO_SCALAR_BITS / window_bits + 1;
+}
+
+uint64_t get_window_value(const uint64_t* limbs, size_t bit_offset, size_t window_bits)
+{
+    const size_t limb_idx = bit_offset >> 6;
+    const size_t limb_shift = bit_offset & 63;
+    if (limb_idx >= 2) {
+        return 0;
+    }
+    uint64_t value = limbs[limb_idx] >> limb_shift;
+    if (limb_shift + window_bits > 64 && limb_idx == 0) {
+        value |= limbs[1] << (64 - limb_shift);
+    }
+    return value & ((1ULL << window_bits) - 1);
+}
+
+/**
+ * @brief Recode a 128-bit scalar into signed digits d_w in [-2^{c-1}, 2^{c-1}] with k = ∑_w d_w ⋅ 2^{cw}
+ * @details Digits are written with a stride of stride, one per window.
+ */
+void compute_signed_digits(
+    const uint64_t* limbs, size_t window_bits, size_t num_windows, uint16_t* digits, size_t stride)
+{
+    const uint64_t half_window = 1ULL << (window_bits - 1);
+    uint64_t carry = 0;
+    for (size_t w = 0; w < num_windows; ++w) {
+        uint64_t value = get_window_value(limbs, w * window_bits, window_bits) + carry;
+        carry = static_cast<uint64_t>(value > half_window);
+        // A negative digit value - 2^c has magnitude 2^c - value < 2^{c-1}, or zero if the carry filled the window
+        const uint64_t magnitude = carry != 0 ? (1ULL << window_bits) - value : value;
+        const uint16_t sign = (carry != 0 && magnitude != 0) ? DIGIT_SIGN_BIT : 0;
+        digits[w * stride] = static_cast<uint16_t>(magnitude) | sign;
+    }
+}
+// Points bucketed per batch-affine pass, which bounds the bucket scratch of each thread independently of the chunk size
+constexpr size_t BUCKET_BATCH_SIZE = 1 << 16;
+
+/**
+ * @brief Scratch space of accumulate_buckets, allocated once per thread and reused across all of its tasks
+ */
+template <typename Curve> struct BucketScratch {
+    std::vector<uint64_t> bucket_offsets;
+    std::vector<uint64_t> sequence_counts;
+    std::vector<size_t> sequence_buckets;
+    std::vector<typename Curve::AffineElement> bucket_points;
+    // Running affine sum of every bucket, carried from one batch of points to the next
+    std::vector<typename Curve::AffineElement> bucket_sums;
+    std::vector<uint8_t> bucket_filled;
+    MsmSorter<Curve> sorter;
+};
+
+/**
+ * @brief Compute ∑_b (b + 1) ⋅ B_b, where bucket B_b holds the sum of the points of the range [start, end) whose digit
+ * has magnitude b + 1, negated if the digit is negative
+ * @details The points of every bucket are summed with affine additions, with the inverses of each round of additions
+ * batched across all buckets. The range is processed in batches of at most max(BUCKET_BATCH_SIZE, 4 * num_buckets)
+ * points, each of which starts every bucket from its sum over the previous batches.
+ */
+template <typename Curve, typename GetDigit, typename GetPoint>
+typename Curve::Element accumulate_buckets(size_t start,
+                                           size_t end,
+                                           size_t num_buckets,
+                                           const GetDigit& get_digit,
+                                           const GetPoint& get_point,
+                                           BucketScratch<Curve>& scratch)
+{
+    using Element = typename Curve::Element;
+    using G1 = typename Curve::AffineElement;
+
+    auto& bucket_offsets = scratch.bucket_offsets;
+    auto& sequence_counts = scratch.sequence_counts;
+    auto& sequence_buckets = scratch.sequence_buckets;
+    auto& bucket_points = scratch.bucket_points;
+    auto& bucket_sums = scratch.bucket_sums;
+    auto& bucket_filled = scratch.bucket_filled;
+    bucket_sums.resize(num_buckets);
+    bucket_filled.assign(num_buckets, 0);
+
+    const size_t batch_size = std::max(BUCKET_BATCH_SIZE, 4 * num_buckets);
+    for (size_t batch_start = start; batch_start < end; batch_start += batch_size) {
+        const size_t batch_end = std::min(batch_start + batch_size, end);
+
+        // Bucket the points of the batch after the sum of each bucket so far, negating those with a negative digit
+        bucket_offsets.assign(num_buckets + 1, 0);
+        for (size_t p = batch_start; p < batch_end; ++p) {
+            const uint16_t digit = get_digit(p);
+            if (digit != 0) {
+                bucket_offsets[static_cast<uint16_t>(digit & ~DIGIT_SIGN_BIT)]++;
+            }
+        }
+        sequence_counts.clear();
+        sequence_buckets.clear();
+        for (size_t b = 0; b < num_buckets; ++b) {
+            bucket_offsets[b + 1] += bucket_filled[b];
+            if (bucket_offsets[b + 1] != 0) {
+                sequence_counts.emplace_back(bucket_offsets[b + 1]);
+                sequence_buckets.emplace_back(b);
+            }
+            bucket_offsets[b + 1] += bucket_offsets[b];
+        }
+        bucket_points.resize(bucket_offsets[num_buckets]);
+        for (size_t b = 0; b < num_buckets; ++b) {
+            if (bucket_filled[b] != 0) {
+                bucket_points[bucket_offsets[b]++] = bucket_sums[b];
+            }
+        }
+        for (size_t p = batch_start; p < batch_end; ++p) {
+            const uint16_t digit = get_digit(p);
+            if (digit != 0) {
+                G1& point = bucket_points[bucket_offsets[static_cast<uint16_t>(digit & ~DIGIT_SIGN_BIT) - 1U]++];
+                point = get_point(p);
+                if ((digit & DIGIT_SIGN_BIT) != 0) {
+                    point.y = -point.y;
+                }
+            }
+        }
+
+        // Reduce every bucket to a single point. The i-th non-empty bucket ends up in bucket_points[i].
+        scratch.sorter.denominators.resize(bucket_points.size() / 2);
+        scratch.sorter.batched_affine_add_in_place({ sequence_counts, bucket_points, {} });
+        for (size_t i = 0; i < sequence_buckets.size(); ++i) {
+            bucket_sums[sequence_buckets[i]] = bucket_points[i];
+            bucket_filled[sequence_buckets[i]] = 1;
+        }
+    }
+
+    // Running sum from the top bucket down
+    Element running_sum;
+    Element bucket_sum;
+    running_sum.self_set_infinity();
+    bucket_sum.self_set_infinity();
+    for (size_t b = num_buckets; b-- > 0;) {
+        if (bucket_filled[b] != 0) {
+            running_sum += bucket_sums[b];
+        }
+        bucket_sum += running_sum;
+    }
+    return bucket_sum;
+}
+
+/**
+ * @brief Run task(task_idx, scratch) for every task_idx < num_tasks, with one bucket scratch per thread that is reused
+ * across all the tasks of that thread
+ */
+template <typename Curve, typename Task> void parallel_for_bucket_tasks(size_t num_tasks, const Task& task)
+{
+    const size_t num_threads = std::min(get_num_cpus(), num_tasks);
+    parallel_for(num_threads, [&](size_t thread_idx) {
+        BucketScratch<Curve> scratch;
+        for (size_t task_idx = thread_idx; task_idx < num_tasks; task_idx += num_threads) {
+            task(task_idx, scratch);
+        }
+    });
+}
+
+/**
+ * @brief Split every scalar with the endomorphism and recode both halves into signed digits
+ * @return The digits of the 2 * num_points halves, window-major
+ */
+template <typename Curve>
+std::vector<uint16_t> compute_scalar_digits(const typename Curve::ScalarField* scalars,
+                                            size_t num_points,
+                                            size_t window_bits,
+                                            size_t num_windows)
+{
+    using Fr = typename Curve::ScalarField;
+    const size_t num_table_points = num_points * 2;
+    std::vector<uint16_t> digits(num_windows * num_table_points);
+    parallel_for(num_points, [&](size_t i) {
+        Fr k = scalars[i].from_montgomery_form();
+        Fr::split_into_endomorphism_scalars(k, k, *(Fr*)&k.data[2]);
+        compute_signed_digits(&k.data[0], window_bits, num_windows, &digits[2 * i], num_table_points);
+        compute_signed_digits(&k.data[2], window_bits, num_windows, &digits[2 * i + 1], num_table_points);
+    });
+    return digits;
+}
+} // namespace
+
+SignedDigitMsmParameters get_signed_digit_msm_parameters(size_t num_points, size_t num_threads)
+{
+    // Both halves of every scalar are added into the buckets of each window
+    const size_t num_table_points = num_points * 2;
+    SignedDigitMsmParameters best{ MIN_WINDOW_BITS, get_num_windows(MIN_WINDOW_BITS), 1 };
+    size_t best_cost = SIZE_MAX;
+    for (size_t window_bits = MIN_WINDOW_BITS; window_bits <= MAX_WINDOW_BITS; ++window_bits) {
+        const size_t num_windows = get_num_windows(window_bits);
+        // Split each window over enough chunks of points to give every thread about two tasks to balance
+        const size_t num_chunks =
+            std::max<size_t>(1, std::min((2 * num_threads + num_windows - 1) / num_windows, num_table_points));
+        const size_t num_buckets = 1ULL << (window_bits - 1);
+        const size_t cost = num_windows * (num_table_points * AFFINE_ADDITION_COST +
+                                           num_chunks * num_buckets * BUCKET_REDUCTION_COST);
+        if (cost < best_cost) {
+            best_cost = cost;
+            best = { window_bits, num_windows, num_chunks };
+        }
+    }
+    return best;
+}
+
+template <typename Curve>
+typename Curve::Element signed_digit_msm(const typename Curve::ScalarField* scalars,
+                                         const typename Curve::AffineElement* points,
+                                         const size_t num_points)
+{
+    BB_OP_COUNT_TIME();
+    using Element = typename Curve::Element;
+
+    Element result;
+    result.self_set_infinity();
+    if (num_points == 0) {
+        return result;
+    }
+
+    const size_t num_table_points = num_points * 2;
+    const auto [window_bits, num_windows, num_chunks] =
+        get_signed_digit_msm_parameters(num_points, get_num_cpus_pow2());
+    const size_t num_buckets = 1ULL << (window_bits - 1);
+
+    // Window-major, so that each task reads a contiguous run of digits
+    const std::vector<uint16_t> digits =
+        compute_scalar_digits<Curve>(scalars, num_points, window_bits, num_windows);
+
+    const size_t chunk_size = (num_table_points + num_chunks - 1) / num_chunks;
+    std::vector<Element> window_sums(num_windows * num_chunks);
+    parallel_for_bucket_tasks<Curve>(num_windows * num_chunks, [&](size_t task_idx, BucketScratch<Curve>& scratch) {
+        const size_t window_idx = task_idx / num_chunks;
+        const size_t start = std::min((task_idx % num_chunks) * chunk_size, num_table_points);
+        const size_t end = std::min(start + chunk_size, num_table_points);
+        const uint16_t* window_digits = &digits[window_idx * num_table_points];
+
+        window_sums[task_idx] = accumulate_buckets<Curve>(
+            start,
+            end,
+            num_buckets,
+            [&](size_t p) { return window_digits[p]; },
+            [&](size_t p) { return points[p]; },
+            scratch);
+    });
+
+    // Horner's rule over the windows, from the top one down
+    for (size_t w = num_windows; w-- > 0;) {
+        for (size_t i = 0; i < window_bits; ++i) {
+            result.self_dbl();
+        }
+        for (size_t chunk = 0; chunk < num_chunks; ++chunk) {
+            result += window_sums[w * num_chunks + chunk];
+        }
+    }
+    return result;
+}
+
+template <typename Curve>
+FixedBaseTable<Curve> compute_fixed_base_table(const typename Curve::AffineElement* point_table,
+                                               const size_t num_points,
+                                               const size_t window_bits,
+                                               const size_t stride)
+{
+    using Element = typename Curve::Element;
+    ASSERT(window_bits >= MIN_WINDOW_BITS && window_bits <= MAX_WINDOW_BITS && stride >= 1);
+
+    FixedBaseTable<Curve> table;
+    table.num_points = num_points;
+    table.window_bits = window_bits;
+    table.stride = stride;
+    table.num_tables = (get_num_windows(window_bits) + stride - 1) / stride;
+
+    const size_t num_table_points = num_points * 2;
+    table.points.resize(table.num_tables * num_table_points);
+    std::copy(point_table, point_table + num_table_points, table.points.begin());
+
+    // Table k is table k - 1 shifted by window_bits * stride doublings
+    const size_t num_doublings = window_bits * stride;
+    const size_t num_threads = calculate_num_threads(num_table_points);
+    const size_t block_size = (num_table_points + num_threads - 1) / num_threads;
+    parallel_for(num_threads, [&](size_t thread_idx) {
+        const size_t start = std::min(thread_idx * block_size, num_table_points);
+        const size_t end = std::min(start + block_size, num_table_points);
+        std::vector<Element> block(end - start);
+        for (size_t k = 1; k < table.num_tables; ++k) {
+            const auto* previous = &table.points[(k - 1) * num_table_points];
+            auto* current = &table.points[k * num_table_points];
+            for (size_t p = start; p < end; ++p) {
+                Element point(previous[p]);
+                for (size_t i = 0; i < num_doublings; ++i) {
+                    point.self_dbl();
+                }
+                block[p - start] = point;
+            }
+            Element::batch_normalize(block.data(), block.size());
+            for (size_t p = start; p < end; ++p) {
+                current[p] = { block[p - start].x, block[p - start].y };
+            }
+        }
+    });
+    return table;
+}
+
+template <typename Curve>
+typename Curve::Element fixed_base_msm(const typename Curve::ScalarField* scalars,
+                                       const FixedBaseTable<Curve>& table,
+                                       const size_t first_point,
+                                       const size_t num_points)
+{
+    BB_OP_COUNT_TIME();
+    using Element = typename Curve::Element;
+    ASSERT(first_point + num_points <= table.num_points);
+
+    Element result;
+    result.self_set_infinity();
+    if (num_points == 0) {
+        return result;
+    }
+
+    const size_t window_bits = table.window_bits;
+    const size_t stride = table.stride;
+    const size_t num_windows = get_num_windows(window_bits);
+    const size_t num_buckets = 1ULL << (window_bits - 1);
+    const size_t num_table_points = num_points * 2;
+    const std::vector<uint16_t> digits = compute_scalar_digits<Curve>(scalars, num_points, window_bits, num_windows);
+
+    // For each offset j < stride, the digits of windows j, j + stride, j + 2 * stride, ... all go into one set of
+    // buckets, each paired with the point of the table that already carries its power of two. The bucket pass runs
+    // over num_tables * num_table_points virtual points, split into chunks to keep all threads busy.
+    const size_t num_virtual_points = table.num_tables * num_table_points;
+    const size_t num_chunks = std::clamp<size_t>(
+        (2 * get_num_cpus_pow2() + stride - 1) / stride, 1, std::max<size_t>(1, num_virtual_points / num_buckets));
+    const size_t chunk_size = (num_virtual_points + num_chunks - 1) / num_chunks;
+    const auto* points = &table.points[2 * first_point];
+    const size_t table_size = table.num_points * 2;
+
+    std::vector<Element> offset_sums(stride * num_chunks);
+    parallel_for_bucket_tasks<Curve>(stride * num_chunks, [&](size_t task_idx, BucketScratch<Curve>& scratch) {
+        const size_t offset = task_idx / num_chunks;
+        const size_t start = std::min((task_idx % num_chunks) * chunk_size, num_virtual_points);
+        const size_t end = std::min(start + chunk_size, num_virtual_points);
+        auto get_digit = [&](size_t v) -> uint16_t {
+            const size_t window_idx = (v / num_table_points) * stride + offset;
+            return window_idx < num_windows ? digits[window_idx * num_table_points + v % num_table_points] : 0;
+        };
+        auto get_point = [&](size_t v) { return points[(v / num_table_points) * table_size + v % num_table_points]; };
+        offset_sums[task_idx] = accumulate_buckets<Curve>(start, end, num_buckets, get_digit, get_point, scratch);
+    });
+
+    // Horner's rule over the offsets; with a stride of 1 there are no doublings at all
+    for (size_t j = stride; j-- > 0;) {
+        if (j + 1 < stride) {
+            for (size_t i = 0; i < window_bits; ++i) {
+                result.self_dbl();
+            }
+        }
+        for (size_t chunk = 0; chunk < num_chunks; ++chunk) {
+            result += offset_sums[j * num_chunks + chunk];
+        }
+    }
+    return result;
+}
+
+template <typename Curve>
+typename Curve::Element msm(typename Curve::ScalarField* scalars,
+                            typename Curve::AffineElement* points,
+                            const size_t num_points,
+                            pippenger_runtime_state<Curve>& state,
+                            MsmEngine engine)
+{
+    // Below the pippenger threshold both engines would be dominated by their fixed costs; pippenger then falls back to
+    // independent scalar multiplications
+    if (engine == MsmEngine::SIGNED_DIGIT_AFFINE && num_points > get_num_cpus_pow2() * 8) {
+        return signed_digit_msm<Curve>(scalars, points, num_points);
+    }
+    return pippenger_unsafe<Curve>(scalars, points, num_points, state);
+}
+
+template curve::BN254::Element signed_digit_msm<curve::BN254>(const curve::BN254::ScalarField* scalars,
+                                                              const curve::BN254::AffineElement* points,
+                                                              size_t num_points);
+template curve::BN254::Element msm<curve::BN254>(curve::BN254::ScalarField* scalars,
+                                                 curve::BN254::AffineElement* points,
+                                                 size_t num_points,
+                                                 pippenger_runtime_state<curve::BN254>& state,
+                                                 MsmEngine engine);
+
+template FixedBaseTable<curve::BN254> compute_fixed_base_table<curve::BN254>(
+    const curve::BN254::AffineElement* point_table, size_t num_points, size_t window_bits, size_t stride);
+template curve::BN254::Element fixed_base_msm<curve::BN254>(const curve::BN254::ScalarField* scalars,
+                                                            const FixedBaseTable<curve::BN254>& table,
+                                                            size_t first_point,
+                                                            size_t num_points);
+
+template curve::Grumpkin::Element signed_digit_msm<curve::Grumpkin>(const curve::Grumpkin::ScalarField* scalars,
+                                                                    const curve::Grumpkin::AffineElement* points,
+                                                                    size_t num_points);
+template curve::Grumpkin::Element msm<curve::Grumpkin>(curve::Grumpkin::ScalarField* scalars,
+                                                       curve::Grumpkin::AffineElement* points,
+                                                       size_t num_points,
+                                                       pippenger_runtime_state<curve::Grumpkin>& state,
+                                                       MsmEngine engine);
+
+template FixedBaseTable<curve::Grumpkin> compute_fixed_base_table<curve::Grumpkin>(
+    const curve::Grumpkin::AffineElement* point_table, size_t num_points, size_t window_bits, size_t stride);
+template curve::Grumpkin::Element fixed_base_msm<curve::Grumpkin>(const curve::Grumpkin::ScalarField* scalars,
+                                                                  const FixedBaseTable<curve::Grumpkin>& table,
+                                                                  size_t first_point,
+                                                                  size_t num_points);
+
+} // namespace bb::scalar_multiplication
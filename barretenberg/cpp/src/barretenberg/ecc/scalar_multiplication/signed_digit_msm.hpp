@@ -0,0 +1,95 @@
+#pragma once
+
+#include "./runtime_states.hpp"
+#include "barretenberg/ecc/curves/bn254/bn254.hpp"
+#include "barretenberg/ecc/curves/grumpkin/grumpkin.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace bb::scalar_multiplication {
+
+/**
+ * @brief The MSM engines available to commitments
+ *
+ * @details PIPPENGER_WNAF is the fixed-wnaf pippenger of scalar_multiplication.cpp and the default. SIGNED_DIGIT_AFFINE
+ * is the signed-digit bucket method with batch-affine bucket accumulation of signed_digit_msm.cpp. It has to be
+ * requested explicitly: benchmark/pippenger_bench times both, and no size was found at which it reliably wins.
+ */
+enum class MsmEngine { PIPPENGER_WNAF, SIGNED_DIGIT_AFFINE };
+
+/**
+ * @brief Parameters of a signed-digit MSM: the window width, and how the work is split into (window, chunk) tasks
+ */
+struct SignedDigitMsmParameters {
+    size_t window_bits;
+    size_t num_windows;
+    size_t num_chunks;
+};
+
+SignedDigitMsmParameters get_signed_digit_msm_parameters(size_t num_points, size_t num_threads);
+
+/**
+ * @brief Compute ∑ᵢ scalars[i] ⋅ Pᵢ with the signed-digit bucket method and batch-affine bucket accumulation
+ *
+ * @details points is a pippenger point table as produced by generate_pippenger_point_table, i.e. each point followed
+ * by its endomorphism point. Every scalar is split into two ~128-bit halves, which are recoded into signed digits in
+ * [-2^{c-1}, 2^{c-1}], so that a c-bit window only needs 2^{c-1} buckets and a negative digit adds the negated point.
+ * The points of each bucket are summed with affine additions whose inverses are batched across all buckets
+ * (MsmSorter::batched_affine_add_in_place), so each addition costs a handful of multiplications instead of a Jacobian
+ * mixed addition. Work is split over (window, chunk of points) tasks so that all threads are busy even for the small
+ * number of windows of a wide window.
+ *
+ * Like pippenger_unsafe, it assumes that no two points added to the same bucket share an x-coordinate, which holds
+ * for the points of an SRS.
+ */
+template <typename Curve>
+typename Curve::Element signed_digit_msm(const typename Curve::ScalarField* scalars,
+                                         const typename Curve::AffineElement* points,
+                                         size_t num_points);
+
+/**
+ * @brief Fixed-base tables for signed-digit MSMs over a prefix of a pippenger point table
+ *
+ * @details Table k holds 2^{c⋅s⋅k} ⋅ Q for every point Q of the point table, where c is the window width and s the
+ * stride. fixed_base_msm adds the digit of every window directly into the buckets of the table that carries its power
+ * of two, so with s = 1 an MSM costs only additions. A stride s > 1 stores s times fewer tables at the price of
+ * (s - 1) ⋅ c doublings per MSM. The tables take ceil((128 / c + 1) / s) times the memory of the point table.
+ */
+template <typename Curve> struct FixedBaseTable {
+    size_t num_points = 0;
+    size_t window_bits = 0;
+    size_t stride = 1;
+    size_t num_tables = 0;
+    // Table k starts at points[k * 2 * num_points]
+    std::vector<typename Curve::AffineElement> points;
+
+    size_t memory_size() const { return points.size() * sizeof(typename Curve::AffineElement); }
+};
+
+template <typename Curve>
+FixedBaseTable<Curve> compute_fixed_base_table(const typename Curve::AffineElement* point_table,
+                                               size_t num_points,
+                                               size_t window_bits,
+                                               size_t stride = 1);
+
+/**
+ * @brief Compute ∑ᵢ scalars[i] ⋅ P_{first_point + i} from fixed-base tables
+ */
+template <typename Curve>
+typename Curve::Element fixed_base_msm(const typename Curve::ScalarField* scalars,
+                                       const FixedBaseTable<Curve>& table,
+                                       size_t first_point,
+                                       size_t num_points);
+
+/**
+ * @brief Compute an MSM over a pippenger point table with the requested engine
+ */
+template <typename Curve>
+typename Curve::Element msm(typename Curve::ScalarField* scalars,
+                            typename Curve::AffineElement* points,
+                            size_t num_points,
+                            pippenger_runtime_state<Curve>& state,
+                            MsmEngine engine = MsmEngine::PIPPENGER_WNAF);
+
+} // namespace bb::scalar_multiplication
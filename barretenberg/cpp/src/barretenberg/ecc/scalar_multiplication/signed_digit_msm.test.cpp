@@ -0,0 +1,186 @@
+#include "barretenberg/ecc/scalar_multiplication/signed_digit_msm.hpp"
+#include "barretenberg/common/test.hpp"
+#include "barretenberg/ecc/scalar_multiplication/point_table.hpp"
+#include "barretenberg/ecc/scalar_multiplication/scalar_multiplication.hpp"
+
+#include <cstddef>
+#include <vector>
+
+namespace bb {
+
+template <typename Curve> class SignedDigitMsmTests : public ::testing::Test {
+
+  public:
+    using G1 = typename Curve::AffineElement;
+    using Element = typename Curve::Element;
+    using Fr = typename Curve::ScalarField;
+
+    struct TestData {
+        std::shared_ptr<G1[]> point_table;
+        std::vector<Fr> scalars;
+    };
+
+    static TestData generate_test_data(size_t num_points)
+    {
+        auto point_table = scalar_multiplication::point_table_alloc<G1>(num_points);
+        for (size_t i = 0; i < num_points; ++i) {
+            point_table.get()[i] = G1::random_element();
+        }
+        scalar_multiplication::generate_pippenger_point_table<Curve>(
+            point_table.get(), point_table.get(), num_points);
+
+        std::vector<Fr> scalars(num_points);
+        for (auto& scalar : scalars) {
+            scalar = Fr::random_element();
+        }
+        return { point_table, scalars };
+    }
+
+    static Element naive_msm(const std::vector<Fr>& scalars, const G1* point_table)
+    {
+        Element result;
+        result.self_set_infinity();
+        for (size_t i = 0; i < scalars.size(); ++i) {
+            result += Element(point_table[2 * i]) * scalars[i];
+        }
+        return result;
+    }
+};
+
+using Curves = ::testing::Types<curve::BN254, curve::Grumpkin>;
+
+TYPED_TEST_SUITE(SignedDigitMsmTests, Curves);
+
+TYPED_TEST(SignedDigitMsmTests, MatchesNaiveMsm)
+{
+    using Curve = TypeParam;
+
+    for (size_t num_points : std::initializer_list<size_t>{ 1, 2, 7, 100 }) {
+        auto [point_table, scalars] = TestFixture::generate_test_data(num_points);
+        auto result = scalar_multiplication::signed_digit_msm<Curve>(scalars.data(), point_table.get(), num_points);
+        EXPECT_EQ(result, TestFixture::naive_msm(scalars, point_table.get()));
+    }
+}
+
+TYPED_TEST(SignedDigitMsmTests, MatchesPippenger)
+{
+    using Curve = TypeParam;
+
+    // Large enough for wide windows, with a size that is not a power of two
+    const size_t num_points = 5000;
+    auto [point_table, scalars] = TestFixture::generate_test_data(num_points);
+    scalar_multiplication::pippenger_runtime_state<Curve> state(num_points);
+
+    auto expected =
+        scalar_multiplication::pippenger_unsafe<Curve>(scalars.data(), point_table.get(), num_points, state);
+    auto result = scalar_multiplication::signed_digit_msm<Curve>(scalars.data(), point_table.get(), num_points);
+    EXPECT_EQ(result, expected);
+}
+
+// Chunks larger than a bucket batch carry the bucket sums of one batch into the next
+TYPED_TEST(SignedDigitMsmTests, MatchesPippengerAcrossBucketBatches)
+{
+    using Curve = TypeParam;
+
+    using G1 = typename Curve::AffineElement;
+    using Element = typename Curve::Element;
+
+    // P_i = 2 ⋅ P_{i - 1} + R is much cheaper to generate than random points, and unlike an arithmetic progression no
+    // two sums of a few of its points coincide
+    const size_t num_points = (1 << 17) + 3;
+    std::vector<Element> elements(num_points);
+    const Element offset = Element::random_element();
+    elements[0] = Element::random_element();
+    for (size_t i = 1; i < num_points; ++i) {
+        elements[i] = elements[i - 1].dbl() + offset;
+    }
+    Element::batch_normalize(elements.data(), num_points);
+    auto point_table = scalar_multiplication::point_table_alloc<G1>(num_points);
+    for (size_t i = 0; i < num_points; ++i) {
+        point_table.get()[i] = G1(elements[i].x, elements[i].y);
+    }
+    scalar_multiplication::generate_pippenger_point_table<Curve>(point_table.get(), point_table.get(), num_points);
+    std::vector<typename Curve::ScalarField> scalars(num_points);
+    for (auto& scalar : scalars) {
+        scalar = Curve::ScalarField::random_element();
+    }
+    scalar_multiplication::pippenger_runtime_state<Curve> state(num_points);
+
+    auto expected =
+        scalar_multiplication::pippenger_unsafe<Curve>(scalars.data(), point_table.get(), num_points, state);
+    auto result = scalar_multiplication::signed_digit_msm<Curve>(scalars.data(), point_table.get(), num_points);
+    EXPECT_EQ(result, expected);
+}
+
+// Scalars whose windows are all zero or all ones exercise empty buckets and the carry out of a full window
+TYPED_TEST(SignedDigitMsmTests, EdgeCaseScalars)
+{
+    using Curve = TypeParam;
+    using Fr = typename Curve::ScalarField;
+
+    const size_t num_points = 64;
+    auto [point_table, scalars] = TestFixture::generate_test_data(num_points);
+    for (size_t i = 0; i < num_points; ++i) {
+        switch (i % 4) {
+        case 0:
+            scalars[i] = Fr::zero();
+            break;
+        case 1:
+            scalars[i] = Fr::one();
+            break;
+        case 2:
+            scalars[i] = -Fr::one();
+            break;
+        default:
+            scalars[i] = Fr(uint256_t(1) << 127) - Fr::one();
+            break;
+        }
+    }
+    auto result = scalar_multiplication::signed_digit_msm<Curve>(scalars.data(), point_table.get(), num_points);
+    EXPECT_EQ(result, TestFixture::naive_msm(scalars, point_table.get()));
+
+    std::fill(scalars.begin(), scalars.end(), Fr::zero());
+    result = scalar_multiplication::signed_digit_msm<Curve>(scalars.data(), point_table.get(), num_points);
+    EXPECT_TRUE(result.is_point_at_infinity());
+}
+
+TYPED_TEST(SignedDigitMsmTests, EnginesAgree)
+{
+    using Curve = TypeParam;
+    using scalar_multiplication::MsmEngine;
+
+    const size_t num_points = 1000;
+    auto [point_table, scalars] = TestFixture::generate_test_data(num_points);
+    scalar_multiplication::pippenger_runtime_state<Curve> state(num_points);
+
+    auto expected = scalar_multiplication::msm<Curve>(
+        scalars.data(), point_table.get(), num_points, state, MsmEngine::PIPPENGER_WNAF);
+    EXPECT_EQ(scalar_multiplication::msm<Curve>(
+                  scalars.data(), point_table.get(), num_points, state, MsmEngine::SIGNED_DIGIT_AFFINE),
+              expected);
+}
+
+TYPED_TEST(SignedDigitMsmTests, FixedBaseMatchesPippenger)
+{
+    using Curve = TypeParam;
+
+    const size_t num_points = 1000;
+    auto [point_table, scalars] = TestFixture::generate_test_data(num_points);
+    scalar_multiplication::pippenger_runtime_state<Curve> state(num_points);
+
+    // A sub-range of the points covered by the tables
+    const size_t first_point = 100;
+    const size_t num_msm_points = 700;
+    auto expected = scalar_multiplication::pippenger_unsafe<Curve>(
+        &scalars[first_point], &point_table[2 * first_point], num_msm_points, state);
+
+    for (size_t stride : std::initializer_list<size_t>{ 1, 2, 5 }) {
+        auto table = scalar_multiplication::compute_fixed_base_table<Curve>(point_table.get(), num_points, 8, stride);
+        EXPECT_EQ(table.num_tables, (128 / 8 + 1 + stride - 1) / stride);
+        auto result =
+            scalar_multiplication::fixed_base_msm<Curve>(&scalars[first_point], table, first_point, num_msm_points);
+        EXPECT_EQ(result, expected);
+    }
+}
+
+} // namespace bb
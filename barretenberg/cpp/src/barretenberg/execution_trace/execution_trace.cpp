@@ -41,6 +41,7 @@ void ExecutionTrace_<Flavor>::add_wires_and_selectors_to_proving_key(TraceData&
             pkey_selector = trace_selector.share();
         }
         proving_key.pub_inputs_offset = trace_data.pub_inputs_offset;
+        proving_key.active_block_ranges = trace_data.active_block_ranges;
     } else if constexpr (IsPlonkFlavor<Flavor>) {
         for (size_t idx = 0; idx < trace_data.wires.size(); ++idx) {
             std::string wire_tag = "w_" + std::to_string(idx + 1) + "_lagrange";
@@ -117,6 +118,16 @@ typename ExecutionTrace_<Flavor>::TraceData ExecutionTrace_<Flavor>::construct_t
             trace_data.pub_inputs_offset = offset;
         }
 
+        // Record the rows populated by this block, extending the previous range if the two are adjacent
+        if (block_size > 0) {
+            auto& ranges = trace_data.active_block_ranges;
+            if (!ranges.empty() && ranges.back().end == offset) {
+                ranges.back().end = offset + block_size;
+            } else {
+                ranges.push_back({ offset, offset + block_size });
+            }
+        }
+
         // If the trace is structured, we populate the data from the next block at a fixed block size offset
         if (is_structured) {
             offset += block.get_fixed_size();
@@ -1,6 +1,7 @@
 #pragma once
 #include "barretenberg/flavor/flavor.hpp"
 #include "barretenberg/plonk_honk_shared/composer/permutation_lib.hpp"
+#include "barretenberg/polynomials/active_range.hpp"
 #include "barretenberg/srs/global_crs.hpp"
 
 namespace bb {
@@ -23,6 +24,9 @@ template <class Flavor> class ExecutionTrace_ {
         std::vector<CyclicPermutation> copy_cycles;
         uint32_t ram_rom_offset = 0;    // offset of the RAM/ROM block in the execution trace
         uint32_t pub_inputs_offset = 0; // offset of the public inputs block in the execution trace
+        // Row ranges populated by the blocks; the wires and selectors vanish outside of them. Adjacent ranges are
+        // merged, so an unstructured trace has a single range.
+        std::vector<ActiveRange> active_block_ranges;
 
         TraceData(size_t dyadic_circuit_size, Builder& builder)
         {
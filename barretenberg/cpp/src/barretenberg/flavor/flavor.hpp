@@ -73,6 +73,7 @@
 #include "barretenberg/ecc/fields/field_conversion.hpp"
 #include "barretenberg/plonk_honk_shared/types/aggregation_object_type.hpp"
 #include "barretenberg/plonk_honk_shared/types/circuit_type.hpp"
+#include "barretenberg/polynomials/active_range.hpp"
 #include "barretenberg/polynomials/barycentric.hpp"
 #include "barretenberg/polynomials/evaluation_domain.hpp"
 #include "barretenberg/polynomials/univariate.hpp"
@@ -115,6 +116,10 @@ template <typename FF, typename CommitmentKey_> class ProvingKey_ {
     // Offset off the public inputs from the start of the execution trace
     size_t pub_inputs_offset = 0;
 
+    // Row ranges of the execution trace populated by gates. The wire polynomials vanish outside of them, which lets a
+    // structured trace commit to its wires without paying for the padding between blocks.
+    std::vector<ActiveRange> active_block_ranges;
+
     // The number of public inputs has to be the same for all instances because they are
     // folded element by element.
     std::vector<FF> public_inputs;
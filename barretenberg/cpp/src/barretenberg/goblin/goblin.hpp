@@ -17,6 +17,7 @@
 #include "barretenberg/ultra_honk/merge_verifier.hpp"
 #include "barretenberg/ultra_honk/ultra_prover.hpp"
 #include "barretenberg/ultra_honk/ultra_verifier.hpp"
+#include <future>
 
 namespace bb {
 
@@ -39,6 +40,7 @@ class GoblinProver {
     using TranslatorBuilder = bb::TranslatorCircuitBuilder;
     using TranslatorProver = bb::TranslatorProver;
     using TranslatorProvingKey = bb::TranslatorFlavor::ProvingKey;
+    using TranslatorCommitmentKey = bb::TranslatorFlavor::CommitmentKey;
     using RecursiveMergeVerifier = bb::stdlib::recursion::goblin::MergeRecursiveVerifier_<MegaCircuitBuilder>;
     using MergeProver = bb::MergeProver_<MegaFlavor>;
     using VerificationKey = MegaFlavor::VerificationKey;
@@ -155,15 +157,50 @@ class GoblinProver {
     /**
      * @brief Construct a translator proof
      *
+     * @param precomputed_key Optional proving key holding the precomputed polynomials (otherwise computed herein)
+     * @param precomputed_commitment_key Optional commitment key for the size of precomputed_key
      */
-    void prove_translator()
+    void prove_translator(const std::shared_ptr<TranslatorProvingKey>& precomputed_key = nullptr,
+                          const std::shared_ptr<TranslatorCommitmentKey>& precomputed_commitment_key = nullptr)
     {
         translator_builder = std::make_unique<TranslatorBuilder>(
             eccvm_prover->translation_batching_challenge_v, eccvm_prover->evaluation_challenge_x, op_queue);
-        translator_prover = std::make_unique<TranslatorProver>(*translator_builder, eccvm_prover->transcript);
+        if (precomputed_key) {
+            translator_prover = std::make_unique<TranslatorProver>(
+                *translator_builder, eccvm_prover->transcript, precomputed_key, precomputed_commitment_key);
+        } else {
+            translator_prover = std::make_unique<TranslatorProver>(*translator_builder, eccvm_prover->transcript);
+        }
         goblin_proof.translator_proof = translator_prover->construct_proof();
     };
 
+    /**
+     * @brief Construct the ECCVM and translator proofs, setting up the translator keys while ECCVM proves
+     * @details The translator transcript extends that of ECCVM and its witness is a function of the last two ECCVM
+     * challenges (evaluation_challenge_x, drawn after sumcheck, and translation_batching_challenge_v, drawn after the
+     * opening proof), so neither its trace nor its commitments can be computed any earlier. What only depends on the
+     * size of the op queue is constructed on a separate thread while ECCVM proves: the proving key (the allocation of
+     * all translator polynomials and the computation of the precomputed ones) and the commitment key (the SRS prefix
+     * and the pippenger scratch space). Everything else in the translator prover still runs after ECCVM.
+     */
+    void prove_eccvm_and_translator()
+    {
+#ifdef NO_MULTITHREADING
+        prove_eccvm();
+        prove_translator();
+#else
+        const size_t mini_circuit_dyadic_size = TranslatorFlavor::compute_mini_circuit_dyadic_size(*op_queue);
+        auto translator_keys = std::async(std::launch::async, [mini_circuit_dyadic_size]() {
+            auto proving_key = std::make_shared<TranslatorProvingKey>(mini_circuit_dyadic_size);
+            auto commitment_key = std::make_shared<TranslatorCommitmentKey>(proving_key->circuit_size);
+            return std::make_pair(proving_key, commitment_key);
+        });
+        prove_eccvm();
+        auto [translator_key, translator_commitment_key] = translator_keys.get();
+        prove_translator(translator_key, translator_commitment_key);
+#endif
+    };
+
     /**
      * @brief Constuct a full Goblin proof (ECCVM, Translator, merge)
      * @details The merge proof is assumed to already have been constucted in the last accumulate step. It is simply
@@ -174,8 +211,7 @@ class GoblinProver {
     GoblinProof prove()
     {
         goblin_proof.merge_proof = std::move(merge_proof);
-        prove_eccvm();
-        prove_translator();
+        prove_eccvm_and_translator();
         return goblin_proof;
     };
 };
@@ -60,6 +60,12 @@ template <typename FF_> class MegaArith {
         }
     };
 
+    // The small test structuring with room for a recursive verifier of a fold of four instances, for testing batched
+    // accumulation
+    struct BatchedFoldingTestStructuredBlockSizes : public SmallTestStructuredBlockSizes {
+        BatchedFoldingTestStructuredBlockSizes() { this->poseidon_internal = 1 << 15; }
+    };
+
     // A minimal structuring specifically tailored to the medium complexity transaction for the ClientIvc benchmark
     struct ClientIvcBenchStructuredBlockSizes : public MegaTraceBlocks<uint32_t> {
         ClientIvcBenchStructuredBlockSizes()
@@ -175,6 +181,9 @@ template <typename FF_> class MegaArith {
             case TraceStructure::SMALL_TEST:
                 fixed_block_sizes = SmallTestStructuredBlockSizes();
                 break;
+            case TraceStructure::BATCHED_FOLDING_TEST:
+                fixed_block_sizes = BatchedFoldingTestStructuredBlockSizes();
+                break;
             case TraceStructure::CLIENT_IVC_BENCH:
                 fixed_block_sizes = ClientIvcBenchStructuredBlockSizes();
                 break;
@@ -0,0 +1,46 @@
+#pragma once
+#include <cstddef>
+#include <span>
+
+namespace bb {
+
+/**
+ * @brief A window [start, end) of rows outside of which a polynomial is zero
+ * @details Many columns are only non-zero on a small range of rows, e.g. AVM gadget selectors, lookup counts and kernel
+ * columns, or any column in the padding at the end of a trace. Knowing the window lets commitments and sumcheck skip the
+ * zero rows entirely.
+ */
+struct ActiveRange {
+    size_t start = 0;
+    size_t end = 0;
+
+    size_t size() const { return end - start; }
+    bool empty() const { return start == end; }
+
+    /**
+     * @brief The window after folding rows (2i, 2i+1) into row i, as done by a sumcheck partial evaluation
+     */
+    ActiveRange folded() const { return empty() ? ActiveRange{} : ActiveRange{ start >> 1, (end + 1) >> 1 }; }
+
+    bool operator==(const ActiveRange& other) const = default;
+};
+
+/**
+ * @brief Compute the smallest window containing all non-zero coefficients
+ * @details Scans inwards from both ends, so a dense polynomial costs two comparisons and a sparse one costs a pass over
+ * its zero rows, which is much cheaper than the field or group operations that are then skipped.
+ */
+template <typename Fr> ActiveRange get_active_range(std::span<const Fr> coefficients)
+{
+    size_t end = coefficients.size();
+    while (end > 0 && coefficients[end - 1].is_zero()) {
+        end--;
+    }
+    size_t start = 0;
+    while (start < end && coefficients[start].is_zero()) {
+        start++;
+    }
+    return { start, end };
+}
+
+} // namespace bb
@@ -4,6 +4,7 @@
 #include "barretenberg/common/thread.hpp"
 #include "barretenberg/numeric/bitop/pow.hpp"
 #include "polynomial_arithmetic.hpp"
+#include <array>
 #include <cstddef>
 #include <fcntl.h>
 #include <list>
@@ -374,8 +375,14 @@ template <typename Fr> void Polynomial<Fr>::add_scaled(std::span<const Fr> other
     parallel_for(num_threads, [&](size_t j) {
         size_t offset = j * range_per_thread;
         size_t end = (j == num_threads - 1) ? offset + range_per_thread + leftovers : offset + range_per_thread;
-        for (size_t i = offset; i < end; ++i) {
-            coefficients_[i] += scaling_factor * other[i];
+        // Scale a cache-sized chunk at a time, then accumulate it
+        std::array<Fr, 64> scaled;
+        for (size_t i = offset; i < end; i += scaled.size()) {
+            const size_t chunk_size = std::min(scaled.size(), end - i);
+            const std::span<Fr> scaled_chunk{ scaled.data(), chunk_size };
+            const std::span<Fr> chunk{ coefficients_ + i, chunk_size };
+            Fr::batch_mul(scaled_chunk, other.subspan(i, chunk_size), scaling_factor);
+            Fr::batch_add(chunk, chunk, scaled_chunk);
         }
     });
 }
@@ -391,9 +398,8 @@ template <typename Fr> Polynomial<Fr>& Polynomial<Fr>::operator+=(std::span<cons
     parallel_for(num_threads, [&](size_t j) {
         size_t offset = j * range_per_thread;
         size_t end = (j == num_threads - 1) ? offset + range_per_thread + leftovers : offset + range_per_thread;
-        for (size_t i = offset; i < end; ++i) {
-            coefficients_[i] += other[i];
-        }
+        const std::span<Fr> chunk{ coefficients_ + offset, end - offset };
+        Fr::batch_add(chunk, chunk, other.subspan(offset, end - offset));
     });
 
     return *this;
@@ -410,9 +416,8 @@ template <typename Fr> Polynomial<Fr>& Polynomial<Fr>::operator-=(std::span<cons
     parallel_for(num_threads, [&](size_t j) {
         size_t offset = j * range_per_thread;
         size_t end = (j == num_threads - 1) ? offset + range_per_thread + leftovers : offset + range_per_thread;
-        for (size_t i = offset; i < end; ++i) {
-            coefficients_[i] -= other[i];
-        }
+        const std::span<Fr> chunk{ coefficients_ + offset, end - offset };
+        Fr::batch_sub(chunk, chunk, other.subspan(offset, end - offset));
     });
 
     return *this;
@@ -428,9 +433,8 @@ template <typename Fr> Polynomial<Fr>& Polynomial<Fr>::operator*=(const Fr scali
     parallel_for(num_threads, [&](size_t j) {
         size_t offset = j * range_per_thread;
         size_t end = (j == num_threads - 1) ? offset + range_per_thread + leftovers : offset + range_per_thread;
-        for (size_t i = offset; i < end; ++i) {
-            coefficients_[i] *= scaling_factor;
-        }
+        const std::span<Fr> chunk{ coefficients_ + offset, end - offset };
+        Fr::batch_mul(chunk, chunk, scaling_factor);
     });
 
     return *this;
@@ -30,6 +30,30 @@ template <typename Fr> std::shared_ptr<Fr[]> get_scratch_space(const size_t num_
 #endif
 }
 
+// Below this FFT block size the butterflies of a block are too few to fill the vectorised field kernels
+constexpr size_t MIN_BATCHED_BUTTERFLY_BLOCK = 16;
+
+/**
+ * @brief Butterflies start, ..., end - 1 of an FFT round with blocks of size m, see the flattened loop in
+ * fft_inner_parallel for the indexing
+ * @details Within a block, the butterflies read consecutive elements and consecutive roots, so each block is handed to
+ * Fr::batch_butterfly as a whole.
+ */
+template <typename Fr>
+void batched_butterflies(Fr* elements, const Fr* round_roots, const size_t m, const size_t start, const size_t end)
+{
+    const size_t block_mask = m - 1;
+    for (size_t i = start; i < end;) {
+        const size_t k1 = (i & ~block_mask) << 1;
+        const size_t j1 = i & block_mask;
+        const size_t num_butterflies = std::min(m - j1, end - i);
+        Fr::batch_butterfly({ elements + k1 + j1, num_butterflies },
+                            { elements + k1 + j1 + m, num_butterflies },
+                            { round_roots + j1, num_butterflies });
+        i += num_butterflies;
+    }
+}
+
 } // namespace
 
 inline uint32_t reverse_bits(uint32_t x, uint32_t bit_length)
@@ -270,12 +294,16 @@ void fft_inner_parallel(std::vector<Fr*> coeffs,
             // so that we can reduce out of our 'coarse' reduction and store the output in `coeffs` instead of
             // `scratch_space`
             if (m != (domain.size >> 1)) {
-                for (size_t i = start; i < end; ++i) {
-                    size_t k1 = (i & index_mask) << 1;
-                    size_t j1 = i & block_mask;
-                    temp = round_roots[j1] * scratch_space[k1 + j1 + m];
-                    scratch_space[k1 + j1 + m] = scratch_space[k1 + j1] - temp;
-                    scratch_space[k1 + j1] += temp;
+                if (m >= MIN_BATCHED_BUTTERFLY_BLOCK) {
+                    batched_butterflies(scratch_space, round_roots, m, start, end);
+                } else {
+                    for (size_t i = start; i < end; ++i) {
+                        size_t k1 = (i & index_mask) << 1;
+                        size_t j1 = i & block_mask;
+                        temp = round_roots[j1] * scratch_space[k1 + j1 + m];
+                        scratch_space[k1 + j1 + m] = scratch_space[k1 + j1] - temp;
+                        scratch_space[k1 + j1] += temp;
+                    }
                 }
             } else {
                 for (size_t i = start; i < end; ++i) {
@@ -380,6 +408,10 @@ void fft_inner_parallel(
             // Finally, we want to treat the final round differently from the others,
             // so that we can reduce out of our 'coarse' reduction and store the output in `coeffs` instead of
             // `scratch_space`
+            if (m >= MIN_BATCHED_BUTTERFLY_BLOCK) {
+                batched_butterflies(target, round_roots, m, start, end);
+                return;
+            }
             for (size_t i = start; i < end; ++i) {
                 size_t k1 = (i & index_mask) << 1;
                 size_t j1 = i & block_mask;
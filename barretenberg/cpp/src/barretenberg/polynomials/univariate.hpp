@@ -355,12 +355,28 @@ template <class Fr, size_t domain_end, size_t domain_start = 0, size_t skip_coun
      */
     template <size_t EXTENDED_DOMAIN_END, size_t NUM_SKIPPED_INDICES = 0>
     Univariate<Fr, EXTENDED_DOMAIN_END, 0, NUM_SKIPPED_INDICES> extend_to() const
+    {
+        Univariate<Fr, EXTENDED_DOMAIN_END, 0, NUM_SKIPPED_INDICES> result;
+        extend_into(result, EXTENDED_DOMAIN_END);
+        return result;
+    }
+
+    /**
+     * @brief Same as \ref extend_to, but writes into an existing univariate and only computes its evaluations
+     * {f(domain_end), ..., f(num_evaluations - 1)}; the remaining ones are left untouched.
+     * @details Lets a caller that knows at runtime that it will only read the first num_evaluations values, e.g.
+     * because only low-degree relations are active on a row, skip the work for the others.
+     *
+     * @param num_evaluations Number of evaluations to compute, between LENGTH and EXTENDED_DOMAIN_END
+     */
+    template <size_t EXTENDED_DOMAIN_END, size_t NUM_SKIPPED_INDICES>
+    void extend_into(Univariate<Fr, EXTENDED_DOMAIN_END, 0, NUM_SKIPPED_INDICES>& result,
+                     const size_t num_evaluations) const
     {
         const size_t EXTENDED_LENGTH = EXTENDED_DOMAIN_END - domain_start;
         using Data = BarycentricData<Fr, LENGTH, EXTENDED_LENGTH>;
         static_assert(EXTENDED_LENGTH >= LENGTH);
-
-        Univariate<Fr, EXTENDED_LENGTH, 0, NUM_SKIPPED_INDICES> result;
+        ASSERT(num_evaluations >= LENGTH && num_evaluations <= EXTENDED_DOMAIN_END);
 
         std::copy(evaluations.begin(), evaluations.end(), result.evaluations.begin());
 
@@ -369,7 +385,7 @@ template <class Fr, size_t domain_end, size_t domain_start = 0, size_t skip_coun
         if constexpr (LENGTH == 2) {
             Fr delta = value_at(1) - value_at(0);
             static_assert(EXTENDED_LENGTH != 0);
-            for (size_t idx = domain_end - 1; idx < EXTENDED_DOMAIN_END - 1; idx++) {
+            for (size_t idx = domain_end - 1; idx < num_evaluations - 1; idx++) {
                 result.value_at(idx + 1) = result.value_at(idx) + delta;
             }
         } else if constexpr (LENGTH == 3) {
@@ -383,7 +399,7 @@ template <class Fr, size_t domain_end, size_t domain_start = 0, size_t skip_coun
                 a_mul += a2;
             }
             Fr extra = a_mul + a + b;
-            for (size_t idx = domain_end - 1; idx < EXTENDED_DOMAIN_END - 1; idx++) {
+            for (size_t idx = domain_end - 1; idx < num_evaluations - 1; idx++) {
                 result.value_at(idx + 1) = result.value_at(idx) + extra;
                 extra += a2;
             }
@@ -442,7 +458,7 @@ template <class Fr, size_t domain_end, size_t domain_start = 0, size_t skip_coun
             Fr three_a_plus_two_b = a_plus_b_times_2 + a;
             Fr linear_term = Fr(domain_end - 1) * three_a_plus_two_b + (a_plus_b + c);
             // For each new evaluation, we do only 6 field additions and 0 muls.
-            for (size_t idx = domain_end - 1; idx < EXTENDED_DOMAIN_END - 1; idx++) {
+            for (size_t idx = domain_end - 1; idx < num_evaluations - 1; idx++) {
                 result.value_at(idx + 1) = result.value_at(idx) + idx_sqr_three_times_a + linear_term;
 
                 idx_sqr_three_times_a += x_a_term + three_a;
@@ -451,7 +467,7 @@ template <class Fr, size_t domain_end, size_t domain_start = 0, size_t skip_coun
                 linear_term += three_a_plus_two_b;
             }
         } else {
-            for (size_t k = domain_end; k != EXTENDED_DOMAIN_END; ++k) {
+            for (size_t k = domain_end; k < num_evaluations; ++k) {
                 result.value_at(k) = 0;
                 // compute each term v_j / (d_j*(x-x_j)) of the sum
                 for (size_t j = domain_start; j != domain_end; ++j) {
@@ -463,7 +479,6 @@ template <class Fr, size_t domain_end, size_t domain_start = 0, size_t skip_coun
                 result.value_at(k) *= Data::full_numerator_values[k];
             }
         }
-        return result;
     }
 
     /**
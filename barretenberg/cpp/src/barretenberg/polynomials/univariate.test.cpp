@@ -150,3 +150,25 @@ TYPED_TEST(UnivariateTest, EvaluationCustomDomain)
         EXPECT_EQ(poly.evaluate(fr(2)), fr(294330751));
     }();
 }
+
+// extend_into with a partial number of evaluations computes the same values as extend_to and leaves the rest untouched
+TYPED_TEST(UnivariateTest, ExtendIntoPartial)
+{
+    constexpr size_t EXTENDED_LENGTH = 12;
+    const auto check = []<size_t LENGTH>() {
+        auto poly = Univariate<fr, LENGTH>::get_random();
+        auto expected = poly.template extend_to<EXTENDED_LENGTH>();
+        for (size_t num_evaluations = LENGTH; num_evaluations <= EXTENDED_LENGTH; ++num_evaluations) {
+            Univariate<fr, EXTENDED_LENGTH> result(fr(-1));
+            poly.extend_into(result, num_evaluations);
+            for (size_t i = 0; i < EXTENDED_LENGTH; ++i) {
+                EXPECT_EQ(result.value_at(i), i < num_evaluations ? expected.value_at(i) : fr(-1));
+            }
+        }
+    };
+    // Lengths 2, 3 and 4 have dedicated extension formulas, 5 uses the generic barycentric one
+    check.template operator()<2>();
+    check.template operator()<3>();
+    check.template operator()<4>();
+    check.template operator()<5>();
+}
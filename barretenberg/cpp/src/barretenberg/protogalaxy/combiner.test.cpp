@@ -1,3 +1,4 @@
+#include "barretenberg/common/constexpr_utils.hpp"
 #include "barretenberg/honk/utils/testing.hpp"
 #include "barretenberg/polynomials/pow.hpp"
 #include "barretenberg/protogalaxy/protogalaxy_prover.hpp"
@@ -377,3 +378,122 @@ TEST(Protogalaxy, CombinerOn4Instances)
     };
     run_test();
 };
+
+// Check the combiner on rows where only some relations are active against a direct evaluation that never skips
+TEST(Protogalaxy, CombinerWithInactiveRelations)
+{
+    constexpr size_t NUM_INSTANCES = 2;
+    using ProverInstance = ProverInstance_<Flavor>;
+    using ProverInstances = ProverInstances_<Flavor, NUM_INSTANCES>;
+    using ProtoGalaxyProver = ProtoGalaxyProver_<ProverInstances>;
+    using Relations = typename Flavor::Relations;
+    using RelationSeparator = typename Flavor::RelationSeparator;
+    constexpr size_t BATCHED_EXTENDED_LENGTH = ProverInstances::BATCHED_EXTENDED_LENGTH;
+
+    // The gate selectors active on each row of the accumulator: all of them, a single one, a mix of degrees, or none
+    const std::vector<std::vector<std::string>> accumulator_selectors{
+        { "q_arith", "q_delta_range", "q_elliptic", "q_aux" },
+        { "q_arith" },
+        { "q_elliptic" },
+        { "q_aux" },
+        { "q_delta_range" },
+        {},
+        { "q_arith", "q_elliptic" },
+        {},
+    };
+    // The optimised combiner assumes that the other instance satisfies every relation, so its only gates are arithmetic
+    // gates with a matching constant. Row 5 is active in this instance only.
+    const std::vector<size_t> instance_arithmetic_rows{ 4, 5 };
+    const size_t log_circuit_size = 3;
+    const size_t circuit_size = 1 << log_circuit_size;
+
+    std::vector<std::shared_ptr<ProverInstance>> instance_data(NUM_INSTANCES);
+    for (size_t idx = 0; idx < NUM_INSTANCES; idx++) {
+        auto instance = std::make_shared<ProverInstance>();
+        auto prover_polynomials = get_zero_prover_polynomials<Flavor>(log_circuit_size);
+        for (auto& polynomial : prover_polynomials.get_all()) {
+            for (auto& value : polynomial) {
+                value = FF::random_element();
+            }
+        }
+        // With these zero, the permutation and lookup relations are inactive and vanish on every row, so that
+        // evaluating them without their skip hooks gives the same result
+        for (auto* polynomial : { &prover_polynomials.z_perm,
+                                  &prover_polynomials.z_perm_shift,
+                                  &prover_polynomials.lagrange_first,
+                                  &prover_polynomials.lagrange_last,
+                                  &prover_polynomials.q_lookup,
+                                  &prover_polynomials.lookup_read_counts,
+                                  &prover_polynomials.lookup_read_tags,
+                                  &prover_polynomials.lookup_inverses }) {
+            std::fill(polynomial->begin(), polynomial->end(), 0);
+        }
+        for (size_t row = 0; row < circuit_size; row++) {
+            const std::vector<std::string> no_selectors;
+            const auto& active = idx == 0 ? accumulator_selectors[row] : no_selectors;
+            for (auto [selector, label] : { std::pair{ &prover_polynomials.q_arith, "q_arith" },
+                                            std::pair{ &prover_polynomials.q_delta_range, "q_delta_range" },
+                                            std::pair{ &prover_polynomials.q_elliptic, "q_elliptic" },
+                                            std::pair{ &prover_polynomials.q_aux, "q_aux" } }) {
+                if (std::find(active.begin(), active.end(), label) == active.end()) {
+                    (*selector)[row] = 0;
+                }
+            }
+        }
+        if (idx > 0) {
+            for (size_t row : instance_arithmetic_rows) {
+                prover_polynomials.q_arith[row] = 1;
+                prover_polynomials.q_c[row] = 0;
+                typename UltraArithmeticRelation<FF>::SumcheckArrayOfValuesOverSubrelations gate_value{};
+                UltraArithmeticRelation<FF>::accumulate(
+                    gate_value, prover_polynomials.get_row(row), RelationParameters<FF>{}, FF(1));
+                prover_polynomials.q_c[row] = -gate_value[0];
+            }
+        }
+        instance->proving_key.polynomials = std::move(prover_polynomials);
+        instance->proving_key.circuit_size = circuit_size;
+        instance_data[idx] = instance;
+    }
+
+    ProverInstances instances{ instance_data };
+    for (auto& alpha : instances.alphas) {
+        alpha = Univariate<FF, BATCHED_EXTENDED_LENGTH>::get_random();
+    }
+    auto pow_polynomial = PowPolynomial<FF>(std::vector<FF>(log_circuit_size));
+    for (auto& beta : pow_polynomial.betas) {
+        beta = FF::random_element();
+    }
+    pow_polynomial.compute_values();
+
+    // Evaluate every relation at each point of the combiner domain, on the rows interpolated between the instances
+    std::array<FF, BATCHED_EXTENDED_LENGTH> expected_evaluations{};
+    RelationParameters<FF> relation_parameters;
+    for (size_t point = 0; point < BATCHED_EXTENDED_LENGTH; point++) {
+        typename Flavor::TupleOfArraysOfValues accumulator{};
+        for (size_t row = 0; row < circuit_size; row++) {
+            auto row_0 = instance_data[0]->proving_key.polynomials.get_row(row);
+            auto row_1 = instance_data[1]->proving_key.polynomials.get_row(row);
+            typename Flavor::AllValues values;
+            for (auto [value, value_0, value_1] : zip_view(values.get_all(), row_0.get_all(), row_1.get_all())) {
+                value = value_0 + (value_1 - value_0) * FF(point);
+            }
+            constexpr_for<0, Flavor::NUM_RELATIONS, 1>([&]<size_t relation_idx>() {
+                std::tuple_element_t<relation_idx, Relations>::accumulate(
+                    std::get<relation_idx>(accumulator), values, relation_parameters, pow_polynomial[row]);
+            });
+        }
+        RelationSeparator alphas;
+        for (size_t idx = 0; idx < alphas.size(); idx++) {
+            alphas[idx] = instances.alphas[idx].value_at(point);
+        }
+        RelationUtils<Flavor>::scale_and_batch_elements(accumulator, alphas, FF(1), expected_evaluations[point]);
+    }
+    EXPECT_EQ(expected_evaluations[1], FF(0));
+
+    ProtoGalaxyProver prover;
+    auto result = prover.compute_combiner</*OptimisationEnabled=*/false>(instances, pow_polynomial);
+    auto optimised_result = prover.compute_combiner(instances, pow_polynomial);
+    auto expected_result = Univariate<FF, BATCHED_EXTENDED_LENGTH>(expected_evaluations);
+    EXPECT_EQ(result, expected_result);
+    EXPECT_EQ(optimised_result, expected_result);
+};
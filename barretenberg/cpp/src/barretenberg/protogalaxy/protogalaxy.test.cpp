@@ -172,6 +172,47 @@ template <typename Flavor> class ProtoGalaxyTests : public testing::Test {
         }
     }
 
+    /**
+     * @brief Check the perturbator tree against the definition F(X) = Σ_i f_i ∏_{j : i_j = 1} (β_j + δ_j X) on an
+     * instance large enough to be split between threads.
+     *
+     */
+    static void test_pertubator_coefficients_large_instance()
+    {
+        const size_t log_instance_size = 12;
+        const size_t instance_size = 1 << log_instance_size;
+        std::vector<FF> betas(log_instance_size);
+        std::vector<FF> deltas(log_instance_size);
+        for (size_t idx = 0; idx < log_instance_size; idx++) {
+            betas[idx] = FF::random_element();
+            deltas[idx] = FF::random_element();
+        }
+        std::vector<FF> full_honk_evaluations(instance_size);
+        for (auto& eval : full_honk_evaluations) {
+            eval = FF::random_element();
+        }
+
+        std::vector<FF> expected_values(log_instance_size + 1, FF(0));
+        for (size_t row = 0; row < instance_size; row++) {
+            std::vector<FF> term = { full_honk_evaluations[row] };
+            for (size_t idx = 0; idx < log_instance_size; idx++) {
+                if (((row >> idx) & 1) == 1) {
+                    term.push_back(FF(0));
+                    for (size_t d = term.size() - 1; d > 0; d--) {
+                        term[d] = term[d] * betas[idx] + term[d - 1] * deltas[idx];
+                    }
+                    term[0] *= betas[idx];
+                }
+            }
+            for (size_t d = 0; d < term.size(); d++) {
+                expected_values[d] += term[d];
+            }
+        }
+
+        auto perturbator = ProtoGalaxyProver::construct_perturbator_coefficients(betas, deltas, full_honk_evaluations);
+        EXPECT_EQ(perturbator, expected_values);
+    }
+
     /**
      * @brief Create a dummy accumulator and ensure coefficient 0 of the computed perturbator is the same as the
      * accumulator's target sum.
@@ -497,6 +538,44 @@ template <typename Flavor> class ProtoGalaxyTests : public testing::Test {
         decide_and_verify(prover_accumulator_2, verifier_accumulator_2, true);
     }
 
+    /**
+     * @brief Check that the folding prover records the rows of the accumulator on which some relation is active, and
+     * that restricting the full Honk evaluations to them does not change the result.
+     *
+     */
+    static void test_accumulator_active_row_ranges()
+    {
+        TraceStructure trace_structure = TraceStructure::SMALL_TEST;
+        TupleOfInstances instances = construct_instances(2, trace_structure);
+
+        auto [prover_accumulator, verifier_accumulator] = fold_and_verify(get<0>(instances), get<1>(instances));
+        ASSERT_TRUE(prover_accumulator->active_row_ranges.has_value());
+
+        size_t num_active_rows = 0;
+        for (const ActiveRange& range : *prover_accumulator->active_row_ranges) {
+            num_active_rows += range.size();
+        }
+        EXPECT_GT(num_active_rows, 0);
+        EXPECT_LT(num_active_rows, prover_accumulator->proving_key.circuit_size);
+
+        const auto& polynomials = prover_accumulator->proving_key.polynomials;
+        auto expected_honk_evals = ProtoGalaxyProver::compute_full_honk_evaluations(
+            polynomials, prover_accumulator->alphas, prover_accumulator->relation_parameters);
+        auto honk_evals = ProtoGalaxyProver::compute_full_honk_evaluations(polynomials,
+                                                                           prover_accumulator->alphas,
+                                                                           prover_accumulator->relation_parameters,
+                                                                           prover_accumulator->active_row_ranges);
+        EXPECT_EQ(honk_evals, expected_honk_evals);
+
+        // The ranges are carried over to the next accumulator
+        TupleOfInstances instances_2 = construct_instances(1, trace_structure);
+        auto [prover_accumulator_2, verifier_accumulator_2] = fold_and_verify(
+            { prover_accumulator, get<0>(instances_2)[0] }, { verifier_accumulator, get<1>(instances_2)[0] });
+        EXPECT_TRUE(prover_accumulator_2->active_row_ranges.has_value());
+        check_accumulator_target_sum_manual(prover_accumulator_2, true);
+        decide_and_verify(prover_accumulator_2, verifier_accumulator_2, true);
+    }
+
     /**
      * @brief Ensure tampering a commitment and then calling the decider causes the decider verification to fail.
      *
@@ -566,6 +645,11 @@ TYPED_TEST(ProtoGalaxyTests, PerturbatorCoefficients)
     TestFixture::test_pertubator_coefficients();
 }
 
+TYPED_TEST(ProtoGalaxyTests, PerturbatorCoefficientsLargeInstance)
+{
+    TestFixture::test_pertubator_coefficients_large_instance();
+}
+
 TYPED_TEST(ProtoGalaxyTests, FullHonkEvaluationsValidCircuit)
 {
     TestFixture::test_full_honk_evaluations_valid_circuit();
@@ -610,6 +694,11 @@ TYPED_TEST(ProtoGalaxyTests, FullProtogalaxyStructuredTraceInhomogeneous)
     TestFixture::test_full_protogalaxy_structured_trace_inhomogeneous_circuits();
 }
 
+TYPED_TEST(ProtoGalaxyTests, AccumulatorActiveRowRanges)
+{
+    TestFixture::test_accumulator_active_row_ranges();
+}
+
 TYPED_TEST(ProtoGalaxyTests, TamperedCommitment)
 {
     TestFixture::test_tampered_commitment();
@@ -3,6 +3,7 @@
 #include "barretenberg/common/thread.hpp"
 #include "barretenberg/ecc/curves/bn254/fr.hpp"
 #include "barretenberg/flavor/flavor.hpp"
+#include "barretenberg/polynomials/active_range.hpp"
 #include "barretenberg/polynomials/pow.hpp"
 #include "barretenberg/polynomials/univariate.hpp"
 #include "barretenberg/protogalaxy/folding_result.hpp"
@@ -23,6 +24,8 @@ template <class ProverInstances_> struct ProtogalaxyProofConstructionState {
     Univariate<FF, ProverInstances_::BATCHED_EXTENDED_LENGTH, ProverInstances_::NUM> combiner_quotient;
     FF compressed_perturbator;
     FoldingResult<typename ProverInstances_::Flavor> result;
+    // Rows of the next accumulator on which some relation is active, recorded while computing the combiner
+    std::optional<std::vector<ActiveRange>> next_active_row_ranges;
 };
 
 template <class ProverInstances_> class ProtoGalaxyProver_ {
@@ -46,6 +49,8 @@ template <class ProverInstances_> class ProtoGalaxyProver_ {
     using Commitment = typename Flavor::Commitment;
 
     using BaseUnivariate = Univariate<FF, ProverInstances::NUM>;
+    // The values of a row of the execution trace of each instance, one univariate per prover polynomial
+    using BaseUnivariates = typename Flavor::template ProverUnivariates<ProverInstances::NUM>;
     // The length of ExtendedUnivariate is the largest length (==max_relation_degree + 1) of a univariate polynomial
     // obtained by composing a relation with folded instance + relation parameters .
     using ExtendedUnivariate = Univariate<FF, (Flavor::MAX_TOTAL_RELATION_LENGTH - 1) * (ProverInstances::NUM - 1) + 1>;
@@ -73,6 +78,9 @@ template <class ProverInstances_> class ProtoGalaxyProver_ {
 
     static constexpr size_t NUM_SUBRELATIONS = ProverInstances::NUM_SUBRELATIONS;
 
+    // Whether a row on which the skip hook of every relation fires is known to contribute nothing to the combiner
+    static constexpr bool ALL_RELATIONS_SKIPPABLE = Utils::template all_relations_skippable<BaseUnivariates>;
+
     ProverInstances instances;
     std::shared_ptr<Transcript> transcript = std::make_shared<Transcript>();
     std::shared_ptr<CommitmentKey> commitment_key;
@@ -151,90 +159,99 @@ template <class ProverInstances_> class ProtoGalaxyProver_ {
      * row. At the end of the function, the linearly dependent contribution is accumulated at index 0 representing the
      * sum f_0(ω) + α_j*g(ω) where f_0 represents the full honk evaluation at row 0, g(ω) is the linearly dependent
      * subrelation and α_j is its corresponding batching challenge.
+     *
+     * If the rows on which some relation is active are known, e.g. from the fold that produced an accumulator, only
+     * those rows are evaluated; every other row is set to zero. The active rows are split evenly between the threads.
      */
-    static std::vector<FF> compute_full_honk_evaluations(const ProverPolynomials& instance_polynomials,
-                                                         const RelationSeparator& alpha,
-                                                         const RelationParameters<FF>& relation_parameters)
+    static std::vector<FF> compute_full_honk_evaluations(
+        const ProverPolynomials& instance_polynomials,
+        const RelationSeparator& alpha,
+        const RelationParameters<FF>& relation_parameters,
+        const std::optional<std::vector<ActiveRange>>& active_row_ranges = std::nullopt)
     {
         auto instance_size = instance_polynomials.get_polynomial_size();
-        std::vector<FF> full_honk_evaluations(instance_size);
-        std::vector<FF> linearly_dependent_contributions(instance_size);
-#ifndef NO_MULTITHREADING
-        std::mutex evaluation_mutex;
-#endif
-        auto linearly_dependent_contribution_accumulator = FF(0);
-        run_loop_in_parallel(instance_size, [&](size_t start_row, size_t end_row) {
-            auto thread_accumulator = FF(0);
-            for (size_t row = start_row; row < end_row; row++) {
-                // TODO(https://github.com/AztecProtocol/barretenberg/issues/940): avoid get_row if possible.
-                auto row_evaluations = instance_polynomials.get_row(row);
-                RelationEvaluations relation_evaluations;
-                Utils::zero_elements(relation_evaluations);
-
-                // Note that the evaluations are accumulated with the gate separation challenge
-                // being 1 at this stage, as this specific randomness is added later through the
-                // power polynomial univariate specific to ProtoGalaxy
-                Utils::template accumulate_relation_evaluations<>(
-                    row_evaluations, relation_evaluations, relation_parameters, FF(1));
-
-                auto output = FF(0);
-                auto running_challenge = FF(1);
-
-                // Sum relation evaluations, batched by their corresponding relation separator challenge, to
-                // get the value of the full honk relation at a specific row
-                auto linearly_dependent_contribution = FF(0);
-                Utils::scale_and_batch_elements(
-                    relation_evaluations, alpha, running_challenge, output, linearly_dependent_contribution);
-                thread_accumulator += linearly_dependent_contribution;
-
-                full_honk_evaluations[row] = output;
-            }
-            {
-#ifndef NO_MULTITHREADING
-                std::unique_lock<std::mutex> evaluation_lock(evaluation_mutex);
-#endif
-                linearly_dependent_contribution_accumulator += thread_accumulator;
+        std::vector<FF> full_honk_evaluations(instance_size, FF(0));
+
+        const std::vector<ActiveRange> row_ranges =
+            active_row_ranges.value_or(std::vector<ActiveRange>{ { 0, instance_size } });
+        size_t num_active_rows = 0;
+        for (const ActiveRange& range : row_ranges) {
+            num_active_rows += range.size();
+        }
+
+        const size_t num_threads = calculate_num_threads(num_active_rows);
+        std::vector<FF> linearly_dependent_contributions(num_threads, FF(0));
+        parallel_for(num_threads, [&](size_t thread_idx) {
+            const size_t start = (thread_idx * num_active_rows) / num_threads;
+            const size_t end = ((thread_idx + 1) * num_active_rows) / num_threads;
+
+            size_t range_offset = 0; // number of active rows in the ranges preceding the current one
+            for (const ActiveRange& range : row_ranges) {
+                const size_t range_start = std::max(start, range_offset);
+                const size_t range_end = std::min(end, range_offset + range.size());
+                for (size_t active_row = range_start; active_row < range_end; active_row++) {
+                    const size_t row = range.start + (active_row - range_offset);
+                    // TODO(https://github.com/AztecProtocol/barretenberg/issues/940): avoid get_row if possible.
+                    auto row_evaluations = instance_polynomials.get_row(row);
+                    RelationEvaluations relation_evaluations;
+                    Utils::zero_elements(relation_evaluations);
+
+                    // Note that the evaluations are accumulated with the gate separation challenge
+                    // being 1 at this stage, as this specific randomness is added later through the
+                    // power polynomial univariate specific to ProtoGalaxy
+                    Utils::template accumulate_relation_evaluations<>(
+                        row_evaluations, relation_evaluations, relation_parameters, FF(1));
+
+                    auto output = FF(0);
+                    auto running_challenge = FF(1);
+
+                    // Sum relation evaluations, batched by their corresponding relation separator challenge, to
+                    // get the value of the full honk relation at a specific row
+                    auto linearly_dependent_contribution = FF(0);
+                    Utils::scale_and_batch_elements(
+                        relation_evaluations, alpha, running_challenge, output, linearly_dependent_contribution);
+                    linearly_dependent_contributions[thread_idx] += linearly_dependent_contribution;
+
+                    full_honk_evaluations[row] = output;
+                }
+                range_offset += range.size();
+                if (range_offset >= end) {
+                    break;
+                }
             }
         });
-        full_honk_evaluations[0] += linearly_dependent_contribution_accumulator;
+        for (const FF& contribution : linearly_dependent_contributions) {
+            full_honk_evaluations[0] += contribution;
+        }
         return full_honk_evaluations;
     }
 
     /**
-     * @brief  Recursively compute the parent nodes of each level in the tree, starting from the leaves. Note that at
-     * each level, the resulting parent nodes will be polynomials of degree (level+1) because we multiply by an
-     * additional factor of X.
+     * @brief Compute the parent nodes of one level of the perturbator tree, in place.
+     * @details The first num_nodes * num_coeffs entries of nodes hold the children, each a polynomial with num_coeffs
+     * coefficients. They are replaced by the num_nodes / 2 parents, each with num_coeffs + 1 coefficients because the
+     * right child is multiplied by β + δX. A parent never starts after its left child, so parents are computed in order
+     * through a scratch buffer without overwriting children that are yet to be read.
      */
-    static std::vector<FF> construct_coefficients_tree(const std::vector<FF>& betas,
-                                                       const std::vector<FF>& deltas,
-                                                       const std::vector<std::vector<FF>>& prev_level_coeffs,
-                                                       size_t level = 1)
+    static void construct_coefficients_tree_level(const FF& beta,
+                                                  const FF& delta,
+                                                  std::vector<FF>& nodes,
+                                                  const size_t num_nodes,
+                                                  const size_t num_coeffs)
     {
-        // if we are at level t in the tree, where t = logn and n is the instance size, we have reached the root which
-        // contains the coefficients of the perturbator polynomial
-        if (level == betas.size()) {
-            return prev_level_coeffs[0];
+        std::vector<FF> parent(num_coeffs + 1);
+        for (size_t parent_idx = 0; parent_idx < (num_nodes >> 1); parent_idx++) {
+            const FF* left = &nodes[(parent_idx << 1) * num_coeffs];
+            const FF* right = left + num_coeffs;
+            parent[0] = left[0] + right[0] * beta;
+            for (size_t d = 1; d < num_coeffs; d++) {
+                parent[d] = left[d] + right[d] * beta + right[d - 1] * delta;
+            }
+            parent[num_coeffs] = right[num_coeffs - 1] * delta;
+            std::copy(parent.begin(),
+                      parent.end(),
+                      nodes.begin() + static_cast<std::ptrdiff_t>(parent_idx * (num_coeffs + 1)));
         }
-
-        auto degree = level + 1;
-        auto prev_level_width = prev_level_coeffs.size();
-        // we need degree + 1 terms to represent the intermediate polynomials
-        std::vector<std::vector<FF>> level_coeffs(prev_level_width >> 1, std::vector<FF>(degree + 1, 0));
-        run_loop_in_parallel(
-            prev_level_width >> 1,
-            [&](size_t start, size_t end) {
-                for (size_t node = start << 1; node < end << 1; node += 2) {
-                    auto parent = node >> 1;
-                    std::copy(
-                        prev_level_coeffs[node].begin(), prev_level_coeffs[node].end(), level_coeffs[parent].begin());
-                    for (size_t d = 0; d < degree; d++) {
-                        level_coeffs[parent][d] += prev_level_coeffs[node + 1][d] * betas[level];
-                        level_coeffs[parent][d + 1] += prev_level_coeffs[node + 1][d] * deltas[level];
-                    }
-                }
-            },
-            /*no_multhreading_if_less_or_equal=*/8);
-        return construct_coefficients_tree(betas, deltas, level_coeffs, level + 1);
     }
 
     /**
@@ -244,40 +261,57 @@ template <class ProverInstances_> class ProtoGalaxyProver_ {
      * the tree, label the branch connecting the left node n_l to its parent by 1 and for the right node n_r by β_i +
      * δ_i X. The value of the parent node n will be constructed as n = n_l + n_r * (β_i + δ_i X). Recurse over each
      * layer until the root is reached which will correspond to the perturbator polynomial F(X).
-     * TODO(https://github.com/AztecProtocol/barretenberg/issues/745): make computation of perturbator more memory
-     * efficient, operate in-place and use std::resize; add multithreading
+     *
+     * @details The leaves are split into one contiguous block per thread (a power of two), and each thread reduces its
+     * block to the root of its subtree in place, without synchronising with the others. Only the top log(num_threads)
+     * levels, which hold a handful of nodes, are then computed on a single thread.
      */
     static std::vector<FF> construct_perturbator_coefficients(const std::vector<FF>& betas,
                                                               const std::vector<FF>& deltas,
                                                               const std::vector<FF>& full_honk_evaluations)
     {
-        auto width = full_honk_evaluations.size();
-        std::vector<std::vector<FF>> first_level_coeffs(width >> 1, std::vector<FF>(2, 0));
-        run_loop_in_parallel(width >> 1, [&](size_t start, size_t end) {
-            // Run loop in parallel can divide the domain in such way that the indices are odd, which we can't tolerate
-            // here, so first we divide the width by two, enable parallelism and then reconstruct even start and end
-            for (size_t node = start << 1; node < end << 1; node += 2) {
-                auto parent = node >> 1;
-                first_level_coeffs[parent][0] =
-                    full_honk_evaluations[node] + full_honk_evaluations[node + 1] * betas[0];
-                first_level_coeffs[parent][1] = full_honk_evaluations[node + 1] * deltas[0];
+        constexpr size_t MIN_LEAVES_PER_THREAD = 1 << 10;
+        const size_t log_width = betas.size();
+        const size_t width = full_honk_evaluations.size();
+        ASSERT(width == (size_t(1) << log_width));
+
+        const size_t num_threads = calculate_num_threads_pow2(width, MIN_LEAVES_PER_THREAD);
+        const size_t subtree_width = width / num_threads;
+        const size_t subtree_log_width = static_cast<size_t>(numeric::get_msb(subtree_width));
+        const size_t subtree_num_coeffs = subtree_log_width + 1;
+
+        std::vector<FF> roots(num_threads * subtree_num_coeffs);
+        parallel_for(num_threads, [&](size_t thread_idx) {
+            const auto leaves = full_honk_evaluations.begin() + static_cast<std::ptrdiff_t>(thread_idx * subtree_width);
+            std::vector<FF> nodes(leaves, leaves + static_cast<std::ptrdiff_t>(subtree_width));
+            for (size_t level = 0; level < subtree_log_width; level++) {
+                construct_coefficients_tree_level(
+                    betas[level], deltas[level], nodes, subtree_width >> level, level + 1);
             }
+            std::copy_n(nodes.begin(),
+                        subtree_num_coeffs,
+                        roots.begin() + static_cast<std::ptrdiff_t>(thread_idx * subtree_num_coeffs));
         });
-        return construct_coefficients_tree(betas, deltas, first_level_coeffs);
+        for (size_t level = subtree_log_width; level < log_width; level++) {
+            construct_coefficients_tree_level(betas[level], deltas[level], roots, width >> level, level + 1);
+        }
+        roots.resize(log_width + 1);
+        return roots;
     }
 
     /**
      * @brief Construct the power perturbator polynomial F(X) in coefficient form from the accumulator, representing the
      * relaxed instance.
-     *
-     *
+     * @details Rows outside of the accumulator's active row ranges, recorded when it was folded, are not evaluated.
      */
     static Polynomial<FF> compute_perturbator(const std::shared_ptr<Instance> accumulator,
                                               const std::vector<FF>& deltas)
     {
         BB_OP_COUNT_TIME();
-        auto full_honk_evaluations = compute_full_honk_evaluations(
-            accumulator->proving_key.polynomials, accumulator->alphas, accumulator->relation_parameters);
+        auto full_honk_evaluations = compute_full_honk_evaluations(accumulator->proving_key.polynomials,
+                                                                   accumulator->alphas,
+                                                                   accumulator->relation_parameters,
+                                                                   accumulator->active_row_ranges);
         const auto betas = accumulator->gate_challenges;
         assert(betas.size() == deltas.size());
         auto coeffs = construct_perturbator_coefficients(betas, deltas, full_honk_evaluations);
@@ -310,6 +344,37 @@ template <class ProverInstances_> class ProtoGalaxyProver_ {
         }
     }
 
+    /**
+     * @brief Determine which relations are active on a row, and how many evaluations of the extended univariates
+     * they read.
+     * @details A relation is active unless its skip hook fires on the values of the row in every instance. Since the
+     * values of each polynomial lie on a line through the instances, checking them is the same as checking the
+     * extended univariates. A relation only reads the first (TOTAL_RELATION_LENGTH - 1) * (NUM - 1) + 1 evaluations,
+     * so the row only needs to be extended as far as its highest-degree active relation requires.
+     *
+     * @return The number of evaluations to extend the row to, 0 if no relation is active
+     */
+    template <size_t relation_idx = 0>
+    static size_t get_active_relations(const BaseUnivariates& base_univariates,
+                                       std::array<bool, Flavor::NUM_RELATIONS>& relation_is_active)
+    {
+        using Relation = std::tuple_element_t<relation_idx, Relations>;
+        if constexpr (isSkippable<Relation, BaseUnivariates>) {
+            relation_is_active[relation_idx] = !Relation::skip(base_univariates);
+        } else {
+            relation_is_active[relation_idx] = true;
+        }
+        constexpr size_t EXTENDED_LENGTH = (Relation::TOTAL_RELATION_LENGTH - 1) * (ProverInstances::NUM - 1) + 1;
+        size_t extended_length = relation_is_active[relation_idx] ? EXTENDED_LENGTH : 0;
+
+        // Repeat for the next relation.
+        if constexpr (relation_idx + 1 < Flavor::NUM_RELATIONS) {
+            extended_length = std::max(
+                extended_length, get_active_relations<relation_idx + 1>(base_univariates, relation_is_active));
+        }
+        return extended_length;
+    }
+
     /**
      * @brief Add the value of each relation over univariates to an appropriate accumulator
      *
@@ -351,8 +416,10 @@ template <class ProverInstances_> class ProtoGalaxyProver_ {
     }
 
     /**
-     * @brief Add the value of each relation over univariates to an appropriate accumulator with index skipping
+     * @brief Add the value of each active relation over univariates to an appropriate accumulator with index skipping
      * optimisation
+     * @details The active relations are determined beforehand by \ref get_active_relations "get_active_relations";
+     * evaluations of the extended univariates past those that the active relations read may be stale.
      *
      * @tparam Parameters relation parameters type
      * @tparam relation_idx The index of the relation
@@ -361,31 +428,23 @@ template <class ProverInstances_> class ProtoGalaxyProver_ {
     void accumulate_relation_univariates(OptimisedTupleOfTuplesOfUnivariates& univariate_accumulators,
                                          const OptimisedExtendedUnivariates& extended_univariates,
                                          const Parameters& relation_parameters,
-                                         const FF& scaling_factor)
+                                         const FF& scaling_factor,
+                                         const std::array<bool, Flavor::NUM_RELATIONS>& relation_is_active)
     {
         using Relation = std::tuple_element_t<relation_idx, Relations>;
-        //  Check if the relation is skippable to speed up accumulation
-        if constexpr (!isSkippable<Relation, decltype(extended_univariates)>) {
-            // If not, accumulate normally
+        if (relation_is_active[relation_idx]) {
             Relation::accumulate(std::get<relation_idx>(univariate_accumulators),
                                  extended_univariates,
                                  relation_parameters,
                                  scaling_factor);
-        } else {
-            // If so, only compute the contribution if the relation is active
-            if (!Relation::skip(extended_univariates)) {
-                Relation::accumulate(std::get<relation_idx>(univariate_accumulators),
-                                     extended_univariates,
-                                     relation_parameters,
-                                     scaling_factor);
-            }
         }
         // Repeat for the next relation.
         if constexpr (relation_idx + 1 < Flavor::NUM_RELATIONS) {
-            accumulate_relation_univariates<
-
-                Parameters,
-                relation_idx + 1>(univariate_accumulators, extended_univariates, relation_parameters, scaling_factor);
+            accumulate_relation_univariates<Parameters, relation_idx + 1>(univariate_accumulators,
+                                                                          extended_univariates,
+                                                                          relation_parameters,
+                                                                          scaling_factor,
+                                                                          relation_is_active);
         }
     }
     /**
@@ -457,6 +516,9 @@ template <class ProverInstances_> class ProtoGalaxyProver_ {
     }
     /**
      * @brief Compute the combiner polynomial $G$ in the Protogalaxy paper using indice skippping optimisation
+     * @details Each row is first checked against the relations' skip hooks. Rows on which no relation is active are
+     * not extended at all, and the others are only extended as far as their highest-degree active relation requires,
+     * so the cost of a row tracks the degree of the gates it actually holds.
      *
      * @todo (https://github.com/AztecProtocol/barretenberg/issues/968) Make combiner tests better
      *
@@ -491,21 +553,45 @@ template <class ProverInstances_> class ProtoGalaxyProver_ {
             Utils::zero_univariates(accum);
         }
 
-        // Construct extended univariates containers; one per thread
+        // Construct base and extended univariates containers; one per thread
+        std::vector<BaseUnivariates> base_univariates(num_threads);
         std::vector<ExtendedUnivatiatesType> extended_univariates;
         extended_univariates.resize(num_threads);
 
+        // Ranges of rows on which some relation is active, one list per thread
+        std::vector<std::vector<ActiveRange>> thread_active_row_ranges(num_threads);
+
         // Accumulate the contribution from each sub-relation
         parallel_for(num_threads, [&](size_t thread_idx) {
             size_t start = thread_idx * iterations_per_thread;
             size_t end = (thread_idx + 1) * iterations_per_thread;
 
+            std::array<bool, Flavor::NUM_RELATIONS> relation_is_active;
             for (size_t idx = start; idx < end; idx++) {
-                // No need to initialise extended_univariates to 0, it's assigned to
-                // Instantiate univariates with skipping to ignore computation in those indices (they are still
-                // available for skipping relations, but all derived univariate will ignore those evaluations)
-                extend_univariates</*skip_count=*/ProverInstances::NUM - 1>(
-                    extended_univariates[thread_idx], instances, idx);
+                instances.row_to_univariates(idx, base_univariates[thread_idx]);
+                const size_t extended_length = get_active_relations(base_univariates[thread_idx], relation_is_active);
+
+                // A row on which every relation can be skipped in all instances contributes nothing to the combiner.
+                // The skip hooks only test linear combinations of the row for zero, so they also fire on this row of
+                // the folded accumulator; record the other rows for the next perturbator computation.
+                if (extended_length == 0) {
+                    continue;
+                }
+                if constexpr (ALL_RELATIONS_SKIPPABLE) {
+                    auto& ranges = thread_active_row_ranges[thread_idx];
+                    if (!ranges.empty() && ranges.back().end == idx) {
+                        ranges.back().end++;
+                    } else {
+                        ranges.push_back({ idx, idx + 1 });
+                    }
+                }
+
+                // No need to initialise extended_univariates to 0, it's assigned to. The indices of the instances other
+                // than the accumulator are skipped: all derived univariates will ignore those evaluations.
+                for (auto [extended_univariate, base_univariate] :
+                     zip_view(extended_univariates[thread_idx].get_all(), base_univariates[thread_idx].get_all())) {
+                    base_univariate.extend_into(extended_univariate, extended_length);
+                }
 
                 FF pow_challenge = pow_betas[idx];
 
@@ -516,7 +602,8 @@ template <class ProverInstances_> class ProtoGalaxyProver_ {
                     thread_univariate_accumulators[thread_idx],
                     extended_univariates[thread_idx],
                     instances.optimised_relation_parameters, // these parameters have already been folded
-                    pow_challenge);
+                    pow_challenge,
+                    relation_is_active);
             }
         });
         Utils::zero_univariates(optimised_univariate_accumulators);
@@ -525,6 +612,20 @@ template <class ProverInstances_> class ProtoGalaxyProver_ {
             Utils::add_nested_tuples(optimised_univariate_accumulators, accumulators);
         }
 
+        if constexpr (ALL_RELATIONS_SKIPPABLE) {
+            std::vector<ActiveRange> active_row_ranges;
+            for (const auto& ranges : thread_active_row_ranges) {
+                for (const ActiveRange& range : ranges) {
+                    if (!active_row_ranges.empty() && active_row_ranges.back().end == range.start) {
+                        active_row_ranges.back().end = range.end;
+                    } else {
+                        active_row_ranges.push_back(range);
+                    }
+                }
+            }
+            state.next_active_row_ranges = std::move(active_row_ranges);
+        }
+
         // Convert from optimised version to non-optimised
         deoptimise_univariates(optimised_univariate_accumulators, univariate_accumulators);
         //  Batch the univariate contributions from each sub-relation to obtain the round univariate
@@ -5,4 +5,7 @@
 namespace bb {
 
 template class ProtoGalaxyProver_<ProverInstances_<MegaFlavor, 2>>;
+// Instances with more than one incoming instance are used by ClientIVC::accumulate_batch
+template class ProtoGalaxyProver_<ProverInstances_<MegaFlavor, 3>>;
+template class ProtoGalaxyProver_<ProverInstances_<MegaFlavor, 4>>;
 } // namespace bb
\ No newline at end of file
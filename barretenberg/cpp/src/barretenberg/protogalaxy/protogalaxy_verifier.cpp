@@ -166,5 +166,7 @@ std::shared_ptr<typename VerifierInstances::Instance> ProtoGalaxyVerifier_<Verif
 
 template class ProtoGalaxyVerifier_<VerifierInstances_<UltraFlavor, 2>>;
 template class ProtoGalaxyVerifier_<VerifierInstances_<MegaFlavor, 2>>;
+template class ProtoGalaxyVerifier_<VerifierInstances_<MegaFlavor, 3>>;
+template class ProtoGalaxyVerifier_<VerifierInstances_<MegaFlavor, 4>>;
 
 } // namespace bb
\ No newline at end of file
@@ -2,6 +2,7 @@
 #include "barretenberg/flavor/flavor.hpp"
 #include "barretenberg/polynomials/pow.hpp"
 #include "barretenberg/relations/relation_parameters.hpp"
+#include "barretenberg/relations/relation_types.hpp"
 #include <tuple>
 namespace bb {
 
@@ -208,6 +209,30 @@ template <typename Flavor> class RelationUtils {
         }
     }
 
+    /**
+     * @brief Whether every relation has a skip hook that can be evaluated on AllEntities
+     * @details Only then is a row on which all of the hooks fire known to contribute nothing to the full Honk relation.
+     */
+    template <typename AllEntities>
+    static constexpr bool all_relations_skippable = []<size_t... idx>(std::index_sequence<idx...>) {
+        return (isSkippable<std::tuple_element_t<idx, Relations>, AllEntities> && ...);
+    }(std::make_index_sequence<NUM_RELATIONS>{});
+
+    /**
+     * @brief Check whether the skip hook of every relation fires on the given values
+     */
+    template <size_t relation_idx = 0> static bool skip_all_relations(const auto& values)
+    {
+        using Relation = std::tuple_element_t<relation_idx, Relations>;
+        if (!Relation::skip(values)) {
+            return false;
+        }
+        if constexpr (relation_idx + 1 < NUM_RELATIONS) {
+            return skip_all_relations<relation_idx + 1>(values);
+        }
+        return true;
+    }
+
     /**
      * Utility methods for tuple of arrays
      */
@@ -1,5 +1,6 @@
 #include "file_crs_factory.hpp"
 #include "../io.hpp"
+#include "../point_table_cache.hpp"
 #include "barretenberg/ecc/curves/bn254/bn254.hpp"
 #include "barretenberg/ecc/curves/bn254/g1.hpp"
 #include "barretenberg/ecc/curves/bn254/pairing.hpp"
@@ -30,9 +31,7 @@ FileVerifierCrs<curve::Grumpkin>::FileVerifierCrs(std::string const& path, const
     : num_points(num_points)
 {
     using Curve = curve::Grumpkin;
-    monomials_ = scalar_multiplication::point_table_alloc<Curve::AffineElement>(num_points);
-    srs::IO<Curve>::read_transcript_g1(monomials_.get(), num_points, path);
-    scalar_multiplication::generate_pippenger_point_table<Curve>(monomials_.get(), monomials_.get(), num_points);
+    monomials_ = PointTableCache<Curve>::load(path, num_points);
     g1_identity = monomials_[0];
 };
 
@@ -49,15 +48,16 @@ size_t FileVerifierCrs<curve::Grumpkin>::get_monomial_size() const
 template <typename Curve>
 FileCrsFactory<Curve>::FileCrsFactory(std::string path, size_t initial_degree)
     : path_(std::move(path))
-    , degree_(initial_degree)
+    , verifier_degree_(initial_degree)
 {}
 
 template <typename Curve>
 std::shared_ptr<bb::srs::factories::ProverCrs<Curve>> FileCrsFactory<Curve>::get_prover_crs(size_t degree)
 {
-    if (degree != degree_ || !prover_crs_) {
-        prover_crs_ = std::make_shared<FileProverCrs<Curve>>(degree, path_);
-        degree_ = degree;
+    std::lock_guard<std::mutex> lock(prover_crs_mutex_);
+    if (!prover_crs_ || degree > prover_crs_->get_monomial_size()) {
+        // Crs already handed out keep their own point table, so the new one is built alongside the old one
+        prover_crs_ = std::make_shared<FileProverCrs<Curve>>(degree, path_, prover_crs_);
     }
     return prover_crs_;
 }
@@ -65,9 +65,10 @@ std::shared_ptr<bb::srs::factories::ProverCrs<Curve>> FileCrsFactory<Curve>::get
 template <typename Curve>
 std::shared_ptr<bb::srs::factories::VerifierCrs<Curve>> FileCrsFactory<Curve>::get_verifier_crs(size_t degree)
 {
-    if (degree != degree_ || !verifier_crs_) {
+    std::lock_guard<std::mutex> lock(verifier_crs_mutex_);
+    if (degree != verifier_degree_ || !verifier_crs_) {
         verifier_crs_ = std::make_shared<FileVerifierCrs<Curve>>(path_, degree);
-        degree_ = degree;
+        verifier_degree_ = degree;
     }
     return verifier_crs_;
 }
@@ -1,22 +1,27 @@
 #pragma once
 #include "../io.hpp"
+#include "../point_table_cache.hpp"
 #include "barretenberg/ecc/curves/bn254/bn254.hpp"
 #include "barretenberg/ecc/curves/grumpkin/grumpkin.hpp"
 #include "barretenberg/ecc/scalar_multiplication/point_table.hpp"
 #include "barretenberg/ecc/scalar_multiplication/scalar_multiplication.hpp"
 #include "crs_factory.hpp"
 #include <cstddef>
+#include <mutex>
 #include <utility>
 
 namespace bb::srs::factories {
 
 /**
  * Create reference strings given a path to a directory of transcript files.
+ *
+ * The prover crs only ever grows: a request for a smaller degree is served by the crs already loaded, and a request
+ * for a larger degree extends it by loading and processing only the missing points. A long-lived prover thus pays for
+ * the largest circuit it has seen once, never for a reload.
  */
 template <typename Curve> class FileCrsFactory : public CrsFactory<Curve> {
   public:
     FileCrsFactory(std::string path, size_t initial_degree = 0);
-    FileCrsFactory(FileCrsFactory&& other) = default;
 
     std::shared_ptr<bb::srs::factories::ProverCrs<Curve>> get_prover_crs(size_t degree) override;
 
@@ -24,8 +29,11 @@ template <typename Curve> class FileCrsFactory : public CrsFactory<Curve> {
 
   private:
     std::string path_;
-    size_t degree_;
+    // The prover crs tracks its own size, the verifier crs is reloaded whenever a different degree is requested
+    std::mutex prover_crs_mutex_;
     std::shared_ptr<bb::srs::factories::ProverCrs<Curve>> prover_crs_;
+    std::mutex verifier_crs_mutex_;
+    size_t verifier_degree_;
     std::shared_ptr<bb::srs::factories::VerifierCrs<Curve>> verifier_crs_;
 };
 
@@ -33,21 +41,24 @@ template <typename Curve> class FileProverCrs : public ProverCrs<Curve> {
   public:
     /**
      * @brief Construct a prover CRS populated with a pippenger point table based on the SRS elements
-     * @details Allocates space in monomials_ for 2 * num_points affine elements, populates the first num_points with
-     * the raw SRS elements P_i, then overwrites the same memory with the 'pippenger point table' which contains the raw
-     * elements P_i at even indices and the endomorphism point (\beta * P_i.x, -P_i.y) at odd indices.
+     * @details The 'pippenger point table' contains the raw elements P_i at even indices and the endomorphism point
+     * (\beta * P_i.x, -P_i.y) at odd indices. It is mapped read-only from the preprocessed cache next to the
+     * transcripts when possible (see PointTableCache), otherwise it is computed from the transcripts and the cache is
+     * refreshed.
      *
      * @param num_points
      * @param path
+     * @param prefix a smaller crs loaded from the same path, whose point table is reused instead of recomputed
      */
-    FileProverCrs(const size_t num_points, std::string const& path)
+    FileProverCrs(const size_t num_points,
+                  std::string const& path,
+                  std::shared_ptr<ProverCrs<Curve>> const& prefix = nullptr)
         : num_points(num_points)
-    {
-        monomials_ = scalar_multiplication::point_table_alloc<typename Curve::AffineElement>(num_points);
-
-        srs::IO<Curve>::read_transcript_g1(monomials_.get(), num_points, path);
-        scalar_multiplication::generate_pippenger_point_table<Curve>(monomials_.get(), monomials_.get(), num_points);
-    };
+        , monomials_(PointTableCache<Curve>::load(path,
+                                                  num_points,
+                                                  prefix ? prefix->get_monomial_points() : nullptr,
+                                                  prefix ? prefix->get_monomial_size() : 0))
+    {}
 
     typename Curve::AffineElement* get_monomial_points() { return monomials_.get(); }
 
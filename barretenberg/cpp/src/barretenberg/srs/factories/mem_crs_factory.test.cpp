@@ -3,6 +3,7 @@
 #include "barretenberg/ecc/curves/bn254/pairing.hpp"
 #include "barretenberg/srs/factories/mem_bn254_crs_factory.hpp"
 #include "barretenberg/srs/factories/mem_grumpkin_crs_factory.hpp"
+#include "barretenberg/srs/factories/mem_prover_crs.hpp"
 #include "file_crs_factory.hpp"
 #include <fstream>
 #include <gtest/gtest.h>
@@ -74,3 +75,34 @@ TEST(reference_string, DISABLED_mem_grumpkin_file_consistency)
                      sizeof(Grumpkin::AffineElement) * 1024 * 2),
               0);
 }
+
+TEST(reference_string, file_bn254_prover_crs_grows_incrementally)
+{
+    auto file_crs = FileCrsFactory<BN254>("../srs_db/ignition");
+
+    // A smaller request after a larger one is served by the crs already loaded
+    auto small_crs = file_crs.get_prover_crs(512);
+    auto large_crs = file_crs.get_prover_crs(1024);
+    EXPECT_EQ(file_crs.get_prover_crs(256), large_crs);
+    EXPECT_EQ(small_crs->get_monomial_size(), 512);
+    EXPECT_EQ(large_crs->get_monomial_size(), 1024);
+
+    // The grown crs matches one loaded in one go
+    std::vector<g1::affine_element> points(1024);
+    ::srs::IO<BN254>::read_transcript_g1(points.data(), 1024, "../srs_db/ignition");
+    MemProverCrs<BN254> mem_prover_crs(points);
+
+    EXPECT_EQ(memcmp(mem_prover_crs.get_monomial_points(),
+                     large_crs->get_monomial_points(),
+                     sizeof(g1::affine_element) * 1024 * 2),
+              0);
+    EXPECT_EQ(memcmp(mem_prover_crs.get_monomial_points(),
+                     small_crs->get_monomial_points(),
+                     sizeof(g1::affine_element) * 512 * 2),
+              0);
+
+    // Growing the prover crs leaves the verifier crs loaded
+    auto verifier_crs = file_crs.get_verifier_crs();
+    file_crs.get_prover_crs(2048);
+    EXPECT_EQ(file_crs.get_verifier_crs(), verifier_crs);
+}
@@ -221,6 +221,16 @@ template <typename Curve> class IO {
     }
 
   public:
+    /**
+     * @brief Get the total number of G1 points of the SRS in dir, as declared by the manifest of its first transcript
+     */
+    static size_t get_num_g1_points(std::string const& dir)
+    {
+        Manifest manifest;
+        read_manifest(get_transcript_path(dir, 0), manifest);
+        return manifest.total_g1_points;
+    }
+
     template <typename AffineElementType> static void byteswap(AffineElementType* elements, size_t elements_size)
     {
         if constexpr (GivingG1AffineElementType<Curve, AffineElementType>) {
@@ -279,18 +289,35 @@ template <typename Curve> class IO {
         byteswap<>(elements, buffer_size);
     }
 
-    static void read_transcript_g1(AffineElement* monomials, size_t degree, std::string const& dir)
+    /**
+     * @brief Read degree G1 points into monomials, starting with the point at index first_point of the SRS
+     *
+     * @details A non-zero first_point lets a caller that already holds a prefix of the SRS load only the points it is
+     * missing. Transcript files that lie entirely before first_point are skipped by their manifests alone.
+     */
+    static void read_transcript_g1(AffineElement* monomials,
+                                   size_t degree,
+                                   std::string const& dir,
+                                   size_t first_point = 0)
     {
         size_t num = 0;
         size_t num_read = 0;
+        size_t num_skipped = 0;
         std::string path = get_transcript_path(dir, num);
 
         while (is_file_exist(path) && num_read < degree) {
             Manifest manifest;
             read_manifest(path, manifest);
 
-            auto offset = sizeof(Manifest);
-            const size_t num_to_read = std::min((size_t)manifest.num_g1_points, degree - num_read);
+            const size_t num_to_skip = std::min((size_t)manifest.num_g1_points, first_point - num_skipped);
+            num_skipped += num_to_skip;
+            if (num_to_skip == manifest.num_g1_points) {
+                path = get_transcript_path(dir, ++num);
+                continue;
+            }
+
+            auto offset = sizeof(Manifest) + sizeof(Fq) * 2 * num_to_skip;
+            const size_t num_to_read = std::min((size_t)manifest.num_g1_points - num_to_skip, degree - num_read);
             const size_t g1_buffer_size = sizeof(Fq) * 2 * num_to_read;
 
             char* buffer = (char*)&monomials[num_read];
@@ -309,11 +336,11 @@ template <typename Curve> class IO {
         if (monomial_srs_condition) {
             throw_or_abort(
                 format("Only read ",
-                       num_read,
+                       num_skipped + num_read,
                        " points from ",
                        path,
                        ", but require ",
-                       degree,
+                       first_point + degree,
                        ". Is your srs large enough? Either run bootstrap.sh to download the transcript.dat "
                        "files to `srs_db/ignition/`, or you might need to download extra transcript.dat files "
                        "by editing `srs_db/download_ignition.sh` or in the case of grumpkin points, use "
@@ -30,3 +30,18 @@ TEST(io, read_transcript_loads_well_formed_srs)
     }
     aligned_free(monomials);
 }
+
+TEST(io, read_transcript_g1_from_offset)
+{
+    size_t degree = 1024;
+    size_t first_point = 300;
+    std::vector<g1::affine_element> all_points(degree);
+    std::vector<g1::affine_element> tail_points(degree - first_point);
+    srs::IO<curve::BN254>::read_transcript_g1(all_points.data(), degree, "../srs_db/ignition");
+    srs::IO<curve::BN254>::read_transcript_g1(
+        tail_points.data(), degree - first_point, "../srs_db/ignition", first_point);
+
+    for (size_t i = 0; i < tail_points.size(); ++i) {
+        EXPECT_EQ(tail_points[i], all_points[first_point + i]);
+    }
+}
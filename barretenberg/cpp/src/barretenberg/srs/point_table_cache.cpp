@@ -0,0 +1,180 @@
+#include "point_table_cache.hpp"
+#include "barretenberg/common/log.hpp"
+#include "barretenberg/ecc/scalar_multiplication/point_table.hpp"
+#include "barretenberg/ecc/scalar_multiplication/scalar_multiplication.hpp"
+#include "io.hpp"
+#include <algorithm>
+#include <array>
+#include <cstdlib>
+
+#ifndef __wasm__
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace bb::srs {
+
+namespace {
+#ifndef __wasm__
+bool write_all(int fd, char const* buffer, size_t size)
+{
+    while (size > 0) {
+        ssize_t written = ::write(fd, buffer, size);
+        if (written <= 0) {
+            return false;
+        }
+        buffer += written;
+        size -= static_cast<size_t>(written);
+    }
+    return true;
+}
+#endif
+} // namespace
+
+template <typename Curve> std::string PointTableCache<Curve>::get_path(std::string const& dir)
+{
+    return format(dir, "/monomial/pippenger_point_table.dat");
+}
+
+template <typename Curve>
+std::shared_ptr<typename Curve::AffineElement[]> PointTableCache<Curve>::map(std::string const& filename,
+                                                                              size_t num_points,
+                                                                              size_t srs_num_points)
+{
+#ifdef __wasm__
+    static_cast<void>(filename);
+    static_cast<void>(num_points);
+    static_cast<void>(srs_num_points);
+    return nullptr;
+#else
+    int fd = ::open(filename.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+        return nullptr;
+    }
+
+    PointTableCacheHeader header;
+    struct stat st;
+    bool valid = ::fstat(fd, &st) == 0 && ::pread(fd, &header, sizeof(header), 0) == sizeof(header) &&
+                 header.magic == PointTableCacheHeader::MAGIC && header.version == PointTableCacheHeader::VERSION &&
+                 header.element_size == sizeof(AffineElement) &&
+                 header.modulus_low_limb == Curve::BaseField::modulus.data[0] && header.num_points >= num_points &&
+                 header.srs_num_points == srs_num_points &&
+                 static_cast<size_t>(st.st_size) == sizeof(header) + 2 * header.num_points * sizeof(AffineElement);
+    if (!valid) {
+        ::close(fd);
+        return nullptr;
+    }
+
+    const auto mapped_size = static_cast<size_t>(st.st_size);
+    void* base = ::mmap(nullptr, mapped_size, PROT_READ, MAP_SHARED, fd, 0);
+    // The mapping holds its own reference to the file
+    ::close(fd);
+    if (base == MAP_FAILED) {
+        return nullptr;
+    }
+
+    auto* point_table = reinterpret_cast<AffineElement*>(static_cast<char*>(base) + sizeof(header));
+    return std::shared_ptr<AffineElement[]>(point_table,
+                                            [base, mapped_size](AffineElement*) { ::munmap(base, mapped_size); });
+#endif
+}
+
+template <typename Curve>
+bool PointTableCache<Curve>::write(std::string const& filename,
+                                   AffineElement const* point_table,
+                                   size_t num_points,
+                                   size_t srs_num_points)
+{
+#ifdef __wasm__
+    static_cast<void>(filename);
+    static_cast<void>(point_table);
+    static_cast<void>(num_points);
+    static_cast<void>(srs_num_points);
+    return false;
+#else
+    PointTableCacheHeader header{};
+    header.magic = PointTableCacheHeader::MAGIC;
+    header.version = PointTableCacheHeader::VERSION;
+    header.element_size = sizeof(AffineElement);
+    header.modulus_low_limb = Curve::BaseField::modulus.data[0];
+    header.num_points = num_points;
+    header.srs_num_points = srs_num_points;
+
+    // Write to a private file and rename it into place, so that concurrent readers and writers only ever see either
+    // the old or the new complete table. mkstemp picks a name no other thread or process is writing to.
+    std::string tmp_filename = format(filename, ".tmp.XXXXXX");
+    int fd = ::mkstemp(tmp_filename.data());
+    if (fd < 0) {
+        return false;
+    }
+    // mkstemp creates the file readable by its owner only
+    bool written = ::fchmod(fd, 0644) == 0 &&
+                   write_all(fd, reinterpret_cast<char const*>(&header), sizeof(header)) &&
+                   write_all(fd, reinterpret_cast<char const*>(point_table), 2 * num_points * sizeof(AffineElement));
+    written = (::close(fd) == 0) && written;
+    if (!written || ::rename(tmp_filename.c_str(), filename.c_str()) != 0) {
+        ::unlink(tmp_filename.c_str());
+        return false;
+    }
+    return true;
+#endif
+}
+
+template <typename Curve>
+std::shared_ptr<typename Curve::AffineElement[]> PointTableCache<Curve>::load(std::string const& dir,
+                                                                               size_t num_points,
+                                                                               AffineElement const* prefix_table,
+                                                                               size_t prefix_num_points)
+{
+    const std::string filename = get_path(dir);
+    const size_t srs_num_points = IO<Curve>::get_num_g1_points(dir);
+
+    if (auto point_table = map(filename, num_points, srs_num_points); point_table != nullptr) {
+        // Guard against a stale cache left over from a different transcript in the same directory. Hashing the whole
+        // transcript would cost as much as rebuilding the table, so the cache is checked against the size of the SRS,
+        // its first points and the last point requested, which catches a cache built from another or truncated SRS.
+        const size_t num_to_check = std::min<size_t>(num_points, 2);
+        std::array<AffineElement, 2> srs_points;
+        IO<Curve>::read_transcript_g1(srs_points.data(), num_to_check, dir);
+        bool matches = true;
+        for (size_t i = 0; i < num_to_check; ++i) {
+            matches = matches && (point_table.get()[2 * i] == srs_points[i]);
+        }
+        if (matches && num_points > num_to_check) {
+            AffineElement last_point;
+            IO<Curve>::read_transcript_g1(&last_point, 1, dir, num_points - 1);
+            matches = point_table.get()[2 * (num_points - 1)] == last_point;
+        }
+        if (matches) {
+            return point_table;
+        }
+    }
+
+    if (prefix_table == nullptr) {
+        prefix_num_points = 0;
+    }
+    prefix_num_points = std::min(prefix_num_points, num_points);
+
+    auto point_table = scalar_multiplication::point_table_alloc<AffineElement>(num_points);
+    std::copy(prefix_table, prefix_table + 2 * prefix_num_points, point_table.get());
+
+    // The raw points of the new chunk are read into the start of its own slot of the table and expanded in place
+    const size_t num_new_points = num_points - prefix_num_points;
+    AffineElement* new_table = point_table.get() + 2 * prefix_num_points;
+    if (num_new_points > 0) {
+        IO<Curve>::read_transcript_g1(new_table, num_new_points, dir, prefix_num_points);
+        scalar_multiplication::generate_pippenger_point_table<Curve>(new_table, new_table, num_new_points);
+    }
+
+    if (!write(filename, point_table.get(), num_points, srs_num_points)) {
+        info("could not write pippenger point table cache to ", filename);
+    }
+    return point_table;
+}
+
+template class PointTableCache<curve::BN254>;
+template class PointTableCache<curve::Grumpkin>;
+
+} // namespace bb::srs
@@ -0,0 +1,85 @@
+#pragma once
+#include "barretenberg/ecc/curves/bn254/bn254.hpp"
+#include "barretenberg/ecc/curves/grumpkin/grumpkin.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+namespace bb::srs {
+
+/**
+ * @brief Header of a preprocessed pippenger point table file
+ *
+ * @details The file holds the header followed by 2 * num_points affine elements, exactly as produced by
+ * generate_pippenger_point_table: the SRS point P_i at index 2i and its endomorphism point at index 2i + 1, all in
+ * Montgomery form and in native byte order. The header is padded to 64 bytes so the point table stays aligned when the
+ * file is mapped. A table for N points is also a valid table for any n <= N points.
+ */
+struct PointTableCacheHeader {
+    static constexpr uint64_t MAGIC = 0x4c42545050424242; // "BBBPPTBL" read as a little endian integer
+    static constexpr uint32_t VERSION = 2;
+
+    uint64_t magic;
+    uint32_t version;
+    uint32_t element_size;
+    uint64_t modulus_low_limb; // low limb of the base field modulus, identifies the curve
+    uint64_t num_points;
+    uint64_t srs_num_points; // total number of G1 points of the SRS the table was built from, as in its manifest
+    uint8_t padding[24];
+};
+static_assert(sizeof(PointTableCacheHeader) == 64);
+
+/**
+ * @brief Persistent, memory-mapped cache of the pippenger point table of a monomial SRS
+ *
+ * @details Reading the transcript files, byteswapping every point into Montgomery form and computing the endomorphism
+ * points costs seconds for large SRS sizes and is repeated by every prover process. The cache stores the finished
+ * table next to the transcripts and maps it read-only, so that startup only costs an mmap and concurrent provers share
+ * one physical copy of the table through the page cache.
+ *
+ * Memory returned from the cache is read-only: the point table must never be written to by its consumers.
+ */
+template <typename Curve> class PointTableCache {
+    using AffineElement = typename Curve::AffineElement;
+
+  public:
+    static std::string get_path(std::string const& dir);
+
+    /**
+     * @brief Map the point table stored in filename, if it is valid, holds at least num_points points and was built
+     * from an SRS of srs_num_points points
+     *
+     * @return A read-only point table that is unmapped with its last reference, or nullptr
+     */
+    static std::shared_ptr<AffineElement[]> map(std::string const& filename, size_t num_points, size_t srs_num_points);
+
+    /**
+     * @brief Atomically replace filename with the given point table of num_points points, built from an SRS of
+     * srs_num_points points
+     *
+     * @return false if the file could not be written, e.g. because the SRS directory is read-only
+     */
+    static bool write(std::string const& filename,
+                      AffineElement const* point_table,
+                      size_t num_points,
+                      size_t srs_num_points);
+
+    /**
+     * @brief Get the pippenger point table for the first num_points points of the monomial SRS in dir
+     *
+     * @details Maps the cached table if there is one large enough and it matches the transcript: it must have been made
+     * from an SRS of the same size, and agree with it on its first points and on the last point requested. Otherwise
+     * reads the transcript, computes the table and tries to refresh the cache with it. If the caller already holds the
+     * table for the first prefix_num_points points, it is copied and only the points past it are read and processed.
+     */
+    static std::shared_ptr<AffineElement[]> load(std::string const& dir,
+                                                 size_t num_points,
+                                                 AffineElement const* prefix_table = nullptr,
+                                                 size_t prefix_num_points = 0);
+};
+
+extern template class PointTableCache<curve::BN254>;
+extern template class PointTableCache<curve::Grumpkin>;
+
+} // namespace bb::srs
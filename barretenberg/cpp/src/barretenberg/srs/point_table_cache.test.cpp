@@ -0,0 +1,120 @@
+#include "point_table_cache.hpp"
+#include "barretenberg/ecc/scalar_multiplication/point_table.hpp"
+#include "barretenberg/ecc/scalar_multiplication/scalar_multiplication.hpp"
+#include "io.hpp"
+#include <cstring>
+#include <filesystem>
+#include <gtest/gtest.h>
+#include <thread>
+#include <vector>
+
+using namespace bb;
+
+namespace {
+std::shared_ptr<g1::affine_element[]> generate_point_table(size_t num_points)
+{
+    auto point_table = scalar_multiplication::point_table_alloc<g1::affine_element>(num_points);
+    srs::IO<curve::BN254>::read_transcript_g1(point_table.get(), num_points, "../srs_db/ignition");
+    scalar_multiplication::generate_pippenger_point_table<curve::BN254>(
+        point_table.get(), point_table.get(), num_points);
+    return point_table;
+}
+} // namespace
+
+TEST(PointTableCache, WriteThenMapRoundTrips)
+{
+    const size_t num_points = 1024;
+    const size_t srs_num_points = srs::IO<curve::BN254>::get_num_g1_points("../srs_db/ignition");
+    const std::string filename = (std::filesystem::temp_directory_path() / "bb_point_table_cache_test.dat").string();
+    auto point_table = generate_point_table(num_points);
+
+    EXPECT_TRUE(srs::PointTableCache<curve::BN254>::write(filename, point_table.get(), num_points, srs_num_points));
+
+    auto mapped = srs::PointTableCache<curve::BN254>::map(filename, num_points, srs_num_points);
+    ASSERT_NE(mapped, nullptr);
+    EXPECT_EQ(memcmp(mapped.get(), point_table.get(), sizeof(g1::affine_element) * 2 * num_points), 0);
+
+    // A cached table serves any smaller size, but not a larger one, another curve or another SRS
+    EXPECT_NE(srs::PointTableCache<curve::BN254>::map(filename, num_points / 2, srs_num_points), nullptr);
+    EXPECT_EQ(srs::PointTableCache<curve::BN254>::map(filename, num_points + 1, srs_num_points), nullptr);
+    EXPECT_EQ(srs::PointTableCache<curve::Grumpkin>::map(filename, num_points, srs_num_points), nullptr);
+    EXPECT_EQ(srs::PointTableCache<curve::BN254>::map(filename, num_points, srs_num_points + 1), nullptr);
+
+    std::filesystem::remove(filename);
+}
+
+/**
+ * @brief Threads refreshing the same cache at once each write their own temporary file, so the table left in place is
+ * always complete and no temporary file is left behind
+ *
+ */
+TEST(PointTableCache, ConcurrentWritesLeaveACompleteTable)
+{
+    const size_t num_points = 256;
+    const size_t srs_num_points = 1024;
+    const auto dir = std::filesystem::temp_directory_path() / "bb_point_table_cache_test_concurrent";
+    std::filesystem::remove_all(dir);
+    std::filesystem::create_directories(dir);
+    const std::string filename = (dir / "pippenger_point_table.dat").string();
+
+    std::vector<g1::affine_element> point_table(2 * num_points);
+    for (auto& point : point_table) {
+        point = g1::affine_element::random_element();
+    }
+
+    std::vector<std::thread> writers;
+    for (size_t i = 0; i < 8; ++i) {
+        writers.emplace_back([&]() {
+            for (size_t j = 0; j < 4; ++j) {
+                EXPECT_TRUE(srs::PointTableCache<curve::BN254>::write(
+                    filename, point_table.data(), num_points, srs_num_points));
+            }
+        });
+    }
+    for (auto& writer : writers) {
+        writer.join();
+    }
+
+    auto mapped = srs::PointTableCache<curve::BN254>::map(filename, num_points, srs_num_points);
+    ASSERT_NE(mapped, nullptr);
+    EXPECT_EQ(memcmp(mapped.get(), point_table.data(), sizeof(g1::affine_element) * 2 * num_points), 0);
+    EXPECT_EQ(std::distance(std::filesystem::directory_iterator(dir), std::filesystem::directory_iterator{}), 1);
+
+    std::filesystem::remove_all(dir);
+}
+
+TEST(PointTableCache, MapMissingFileReturnsNull)
+{
+    EXPECT_EQ(srs::PointTableCache<curve::BN254>::map("../srs_db/ignition/monomial/does_not_exist.dat", 1, 1), nullptr);
+}
+
+/**
+ * @brief A cache that agrees with the SRS on its first points but not on its last is rebuilt rather than served
+ *
+ */
+TEST(PointTableCache, LoadRejectsCacheDivergingFromTheSrs)
+{
+    const size_t num_points = 1024;
+    const auto dir = std::filesystem::temp_directory_path() / "bb_point_table_cache_test_srs";
+    std::filesystem::create_directories(dir / "monomial");
+    const auto transcript = dir / "monomial" / "transcript00.dat";
+    std::filesystem::remove(transcript);
+    std::filesystem::create_symlink(std::filesystem::absolute("../srs_db/ignition/monomial/transcript00.dat"),
+                                    transcript);
+    const size_t srs_num_points = srs::IO<curve::BN254>::get_num_g1_points(dir.string());
+
+    auto point_table = generate_point_table(num_points);
+    auto stale_table = generate_point_table(num_points);
+    stale_table[2 * (num_points - 1)] = stale_table[2 * (num_points - 2)];
+    const std::string filename = srs::PointTableCache<curve::BN254>::get_path(dir.string());
+    ASSERT_TRUE(srs::PointTableCache<curve::BN254>::write(filename, stale_table.get(), num_points, srs_num_points));
+
+    auto loaded = srs::PointTableCache<curve::BN254>::load(dir.string(), num_points);
+    EXPECT_EQ(memcmp(loaded.get(), point_table.get(), sizeof(g1::affine_element) * 2 * num_points), 0);
+    // The cache was refreshed with the table read from the SRS
+    auto mapped = srs::PointTableCache<curve::BN254>::map(filename, num_points, srs_num_points);
+    ASSERT_NE(mapped, nullptr);
+    EXPECT_EQ(memcmp(mapped.get(), point_table.get(), sizeof(g1::affine_element) * 2 * num_points), 0);
+
+    std::filesystem::remove_all(dir);
+}
@@ -60,7 +60,7 @@ class ECCOpQueue {
     uint32_t num_precompute_table_rows = 0;
     uint32_t num_msm_rows = 0;
 
-    const std::vector<ECCVMOperation>& get_raw_ops() { return raw_ops; }
+    const std::vector<ECCVMOperation>& get_raw_ops() const { return raw_ops; }
 
     // TODO(https://github.com/AztecProtocol/barretenberg/issues/905): Can remove this with better handling of scalar
     // mul against 0
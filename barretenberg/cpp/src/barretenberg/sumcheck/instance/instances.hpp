@@ -74,6 +74,21 @@ template <typename Flavor_, size_t NUM_ = 2> struct ProverInstances_ {
         return results;
     }
 
+    /**
+     * @brief Write the values of each prover polynomial at row_idx into a container of univariates over the instances
+     */
+    template <typename Univariates> void row_to_univariates(size_t row_idx, Univariates& univariates) const
+    {
+        size_t instance_idx = 0;
+        for (const auto& instance : _data) {
+            auto polynomials = instance->proving_key.polynomials.get_all();
+            for (auto [result, polynomial] : zip_view(univariates.get_all(), polynomials)) {
+                result.evaluations[instance_idx] = polynomial[row_idx];
+            }
+            instance_idx++;
+        }
+    }
+
   private:
     // Returns a vector containing pointer views to the prover polynomials corresponding to each instance.
     auto get_polynomials_views() const
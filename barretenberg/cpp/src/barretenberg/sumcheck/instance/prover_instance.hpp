@@ -5,6 +5,7 @@
 #include "barretenberg/plonk_honk_shared/arithmetization/ultra_arithmetization.hpp"
 #include "barretenberg/plonk_honk_shared/composer/composer_lib.hpp"
 #include "barretenberg/plonk_honk_shared/composer/permutation_lib.hpp"
+#include "barretenberg/polynomials/active_range.hpp"
 #include "barretenberg/relations/relation_parameters.hpp"
 #include "barretenberg/stdlib_circuit_builders/mega_flavor.hpp"
 #include "barretenberg/stdlib_circuit_builders/ultra_flavor.hpp"
@@ -44,6 +45,11 @@ template <class Flavor> class ProverInstance_ {
     std::vector<FF> gate_challenges;
     FF target_sum;
 
+    // Sorted, disjoint ranges of rows outside of which every relation can be skipped. Recorded by the folding prover
+    // for accumulators so that the next fold only evaluates the relations on these rows; unset if unknown. They are
+    // not updated if the polynomials are modified afterwards.
+    std::optional<std::vector<ActiveRange>> active_row_ranges;
+
     ProverInstance_(Circuit& circuit, TraceStructure trace_structure = TraceStructure::NONE)
     {
         BB_OP_COUNT_TIME_NAME("ProverInstance(Circuit&)");
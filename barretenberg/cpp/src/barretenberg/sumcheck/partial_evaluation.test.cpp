@@ -318,3 +318,118 @@ TYPED_TEST(PartialEvaluationTests, ThreeRoundsGenericMultiplePolys)
         EXPECT_EQ((polynomial_get_all[i])[0], expected_val[i]);
     }
 }
+
+/*
+ * Columns that are zero outside of a window of rows are only folded within that window once the active ranges are
+ * known. The result must match folding every row.
+ */
+TYPED_TEST(PartialEvaluationTests, ActiveRangesMatchDense)
+{
+    using Flavor = TypeParam;
+    using FF = typename Flavor::FF;
+    using Transcript = typename Flavor::Transcript;
+    using ProverPolynomials = typename Flavor::ProverPolynomials;
+
+    const size_t multivariate_d(5);
+    const size_t multivariate_n(1 << multivariate_d);
+
+    ProverPolynomials full_polynomials(multivariate_n);
+    size_t column_idx = 0;
+    for (auto& poly : full_polynomials.get_unshifted()) {
+        // Windows of varying length and alignment, including empty ones
+        const size_t start = (column_idx * 7) % multivariate_n;
+        const size_t end = std::min(start + column_idx % 11, multivariate_n);
+        for (size_t i = start; i < end; i++) {
+            poly[i] = FF::random_element();
+        }
+        column_idx++;
+    }
+    full_polynomials.set_shifted();
+
+    auto transcript = Transcript::prover_init_empty();
+    auto dense_sumcheck = SumcheckProver<Flavor>(multivariate_n, transcript);
+    auto sparse_sumcheck = SumcheckProver<Flavor>(multivariate_n, transcript);
+    sparse_sumcheck.compute_active_ranges(full_polynomials);
+
+    FF round_challenge = FF::random_element();
+    dense_sumcheck.partially_evaluate(full_polynomials, multivariate_n, round_challenge);
+    sparse_sumcheck.partially_evaluate(full_polynomials, multivariate_n, round_challenge);
+    for (size_t round_size = multivariate_n >> 1; round_size > 1; round_size >>= 1) {
+        for (auto [dense_poly, sparse_poly] : zip_view(dense_sumcheck.partially_evaluated_polynomials.get_all(),
+                                                       sparse_sumcheck.partially_evaluated_polynomials.get_all())) {
+            for (size_t i = 0; i < round_size; i++) {
+                EXPECT_EQ(dense_poly[i], sparse_poly[i]);
+            }
+        }
+        round_challenge = FF::random_element();
+        dense_sumcheck.partially_evaluate(dense_sumcheck.partially_evaluated_polynomials, round_size, round_challenge);
+        sparse_sumcheck.partially_evaluate(
+            sparse_sumcheck.partially_evaluated_polynomials, round_size, round_challenge);
+    }
+    for (auto [dense_poly, sparse_poly] : zip_view(dense_sumcheck.partially_evaluated_polynomials.get_all(),
+                                                   sparse_sumcheck.partially_evaluated_polynomials.get_all())) {
+        EXPECT_EQ(dense_poly[0], sparse_poly[0]);
+    }
+}
+
+/*
+ * The book-keeping table is folded in tiles of rows, in place from the second round on. Check every round against a
+ * straightforward out-of-place fold, on a table large enough to be split into several bands and tiles.
+ */
+TYPED_TEST(PartialEvaluationTests, TiledFoldMatchesReference)
+{
+    using Flavor = TypeParam;
+    using FF = typename Flavor::FF;
+    using Transcript = typename Flavor::Transcript;
+    using ProverPolynomials = typename Flavor::ProverPolynomials;
+
+    const size_t multivariate_d(12);
+    const size_t multivariate_n(1 << multivariate_d);
+
+    ProverPolynomials full_polynomials(multivariate_n);
+    size_t column_idx = 0;
+    for (auto& poly : full_polynomials.get_unshifted()) {
+        // Every third column is dense, the others are zero outside of a window
+        const size_t start = column_idx % 3 == 0 ? 1 : (column_idx * 389) % multivariate_n;
+        const size_t end = column_idx % 3 == 0 ? multivariate_n : std::min(start + column_idx * 97, multivariate_n);
+        for (size_t i = start; i < end; i++) {
+            poly[i] = FF::random_element();
+        }
+        column_idx++;
+    }
+    full_polynomials.set_shifted();
+
+    std::vector<std::vector<FF>> expected;
+    for (auto& poly : full_polynomials.get_all()) {
+        expected.emplace_back(poly.begin(), poly.end());
+    }
+    auto fold_expected = [&](size_t round_size, const FF& round_challenge) {
+        for (auto& column : expected) {
+            std::vector<FF> folded(round_size >> 1);
+            for (size_t i = 0; i < folded.size(); i++) {
+                folded[i] = column[2 * i] + round_challenge * (column[2 * i + 1] - column[2 * i]);
+            }
+            column = std::move(folded);
+        }
+    };
+
+    auto sumcheck = SumcheckProver<Flavor>(multivariate_n, Transcript::prover_init_empty());
+    sumcheck.compute_active_ranges(full_polynomials);
+
+    FF round_challenge = FF::random_element();
+    sumcheck.partially_evaluate(full_polynomials, multivariate_n, round_challenge);
+    fold_expected(multivariate_n, round_challenge);
+    for (size_t round_size = multivariate_n >> 1; round_size >= 1; round_size >>= 1) {
+        for (auto [poly, expected_column] : zip_view(sumcheck.partially_evaluated_polynomials.get_all(), expected)) {
+            for (size_t i = 0; i < round_size; i++) {
+                ASSERT_EQ(poly[i], expected_column[i]);
+            }
+        }
+        if (round_size == 1) {
+            break;
+        }
+        round_challenge = FF::random_element();
+        sumcheck.partially_evaluate(sumcheck.partially_evaluated_polynomials, round_size, round_challenge);
+        fold_expected(round_size, round_challenge);
+    }
+}
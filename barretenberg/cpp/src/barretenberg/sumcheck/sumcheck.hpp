@@ -1,5 +1,6 @@
 #pragma once
 #include "barretenberg/plonk_honk_shared/library/grand_product_delta.hpp"
+#include "barretenberg/polynomials/active_range.hpp"
 #include "barretenberg/sumcheck/instance/prover_instance.hpp"
 #include "barretenberg/sumcheck/sumcheck_output.hpp"
 #include "barretenberg/transcript/transcript.hpp"
@@ -134,6 +135,13 @@ template <typename Flavor> class SumcheckProver {
      *
      */
     const size_t multivariate_d;
+    /**
+     * @brief Low-memory mode: the round univariate of the second round is computed on the fly from the full
+     * polynomials, and the book-keeping table is only populated after the second challenge. This halves the size of
+     * #partially_evaluated_polynomials, which is never written at \f$ n/2 \f$ rows, at the cost of folding the full
+     * polynomials at \f$ u_0 \f$ twice.
+     */
+    const bool fuse_first_fold;
 
     std::shared_ptr<Transcript> transcript;
     SumcheckProverRound<Flavor> round;
@@ -148,13 +156,21 @@ template <typename Flavor> class SumcheckProver {
     * TODO(#224)(Cody): might want to just do C-style multidimensional array? for guaranteed adjacency?
     */
     PartiallyEvaluatedMultivariates partially_evaluated_polynomials;
+    /**
+     * @brief For each column, the window of rows outside of which it is zero in the current round. Computed from the
+     * full polynomials by \ref compute_active_ranges "compute_active_ranges" and folded along with the polynomials, so
+     * that \ref partially_evaluate "partially_evaluate" only touches the active rows. Left empty, all rows are treated
+     * as active.
+     */
+    std::vector<ActiveRange> active_ranges;
     // prover instantiates sumcheck with circuit size and a prover transcript
-    SumcheckProver(size_t multivariate_n, const std::shared_ptr<Transcript>& transcript)
+    SumcheckProver(size_t multivariate_n, const std::shared_ptr<Transcript>& transcript, bool low_memory = false)
         : multivariate_n(multivariate_n)
         , multivariate_d(numeric::get_msb(multivariate_n))
+        , fuse_first_fold(low_memory && multivariate_d >= 2)
         , transcript(transcript)
         , round(multivariate_n)
-        , partially_evaluated_polynomials(multivariate_n){};
+        , partially_evaluated_polynomials(fuse_first_fold ? multivariate_n >> 1 : multivariate_n){};
 
     /**
      * @brief Compute round univariate, place it in transcript, compute challenge, partially evaluate. Repeat
@@ -191,18 +207,45 @@ template <typename Flavor> class SumcheckProver {
         std::vector<FF> multivariate_challenge;
         multivariate_challenge.reserve(multivariate_d);
 
+        compute_active_ranges(full_polynomials);
+        round.compute_active_row_ranges(full_polynomials);
+
         // In the first round, we compute the first univariate polynomial and populate the book-keeping table of
         // #partially_evaluated_polynomials, which has \f$ n/2 \f$ rows and \f$ N \f$ columns.
         auto round_univariate = round.compute_univariate(full_polynomials, relation_parameters, pow_univariate, alpha);
         transcript->send_to_verifier("Sumcheck:univariate_0", round_univariate);
         FF round_challenge = transcript->template get_challenge<FF>("Sumcheck:u_0");
         multivariate_challenge.emplace_back(round_challenge);
-        partially_evaluate(full_polynomials, multivariate_n, round_challenge);
-        pow_univariate.partially_evaluate(round_challenge);
-        round.round_size = round.round_size >> 1; // TODO(#224)(Cody): Maybe partially_evaluate should do this and
-                                                  // release memory?        // All but final round
-                                                  // We operate on partially_evaluated_polynomials in place.
-        for (size_t round_idx = 1; round_idx < multivariate_d; round_idx++) {
+        size_t round_idx = 1;
+        if (fuse_first_fold) {
+            pow_univariate.partially_evaluate(round_challenge);
+            round.round_size = round.round_size >> 1;
+            round.fold_active_row_ranges();
+
+            // In low-memory mode, the second round reads the full polynomials folded at u_0 on the fly and both
+            // challenges are applied at once when populating the (n/4)-row book-keeping table.
+            const FF first_challenge = round_challenge;
+            FoldedPolynomialsView folded_polynomials(full_polynomials, first_challenge);
+            round_univariate =
+                round.compute_univariate(folded_polynomials, relation_parameters, pow_univariate, alpha);
+            transcript->send_to_verifier("Sumcheck:univariate_1", round_univariate);
+            round_challenge = transcript->template get_challenge<FF>("Sumcheck:u_1");
+            multivariate_challenge.emplace_back(round_challenge);
+            partially_evaluate_twice(full_polynomials, multivariate_n, first_challenge, round_challenge);
+            pow_univariate.partially_evaluate(round_challenge);
+            round.round_size = round.round_size >> 1;
+            round.fold_active_row_ranges();
+            round_idx = 2;
+        } else {
+            partially_evaluate(full_polynomials, multivariate_n, round_challenge);
+            pow_univariate.partially_evaluate(round_challenge);
+            round.round_size = round.round_size >> 1; // TODO(#224)(Cody): Maybe partially_evaluate should do this and
+                                                      // release memory?
+            round.fold_active_row_ranges();
+        }
+        // All but final round
+        // We operate on partially_evaluated_polynomials in place.
+        for (; round_idx < multivariate_d; round_idx++) {
             // Write the round univariate to the transcript
             round_univariate =
                 round.compute_univariate(partially_evaluated_polynomials, relation_parameters, pow_univariate, alpha);
@@ -212,6 +255,7 @@ template <typename Flavor> class SumcheckProver {
             partially_evaluate(partially_evaluated_polynomials, round.round_size, round_challenge);
             pow_univariate.partially_evaluate(round_challenge);
             round.round_size = round.round_size >> 1;
+            round.fold_active_row_ranges();
         }
         auto zero_univariate = bb::Univariate<FF, Flavor::BATCHED_RELATION_PARTIAL_LENGTH>::zero();
         for (size_t idx = multivariate_d; idx < CONST_PROOF_SIZE_LOG_N; idx++) {
@@ -267,15 +311,74 @@ template <typename Flavor> class SumcheckProver {
      */
     void partially_evaluate(auto& polynomials, size_t round_size, FF round_challenge)
     {
+        auto poly_view = polynomials.get_all();
+        const size_t num_columns = poly_view.size();
+        const bool use_active_ranges = active_ranges.size() == num_columns;
+
+        // Rows outside of the active range of a column are zero and fold to zero. The book-keeping table starts out
+        // zeroed, so only the active rows need to be written. However, when folding in place, rows that were active
+        // before this round but lie beyond the folded range still hold the previous round's values.
+        std::vector<ActiveRange> folded_ranges(num_columns, ActiveRange{ 0, round_size >> 1 });
+        std::vector<size_t> stale_ends(num_columns, 0);
+        if (use_active_ranges) {
+            for (size_t j = 0; j < num_columns; j++) {
+                folded_ranges[j] = active_ranges[j].folded();
+                stale_ends[j] = std::min(active_ranges[j].end, round_size >> 1);
+            }
+        }
+
+        const bool in_place =
+            static_cast<const void*>(&polynomials) == static_cast<const void*>(&partially_evaluated_polynomials);
+        fold_rows(poly_view, round_size, round_challenge, folded_ranges, stale_ends, in_place);
+        if (use_active_ranges) {
+            active_ranges = std::move(folded_ranges);
+        }
+    };
+
+    /**
+     * @brief Record the active range of each of the full polynomials, see #active_ranges
+     * @details Must be called before the first partial evaluation, on a freshly constructed (zeroed)
+     * #partially_evaluated_polynomials table.
+     */
+    void compute_active_ranges(auto& polynomials)
+    {
+        auto poly_view = polynomials.get_all();
+        active_ranges.resize(poly_view.size());
+        parallel_for(poly_view.size(), [&](size_t j) { active_ranges[j] = get_active_range<FF>(poly_view[j]); });
+    }
+    /**
+     * @brief Populate the book-keeping table from the full polynomials at the first two round challenges at once, see
+     * #fuse_first_fold
+     * @details Row \f$ \ell \f$ of the table is computed from rows \f$ 4\ell, \ldots, 4\ell + 3 \f$ of the full
+     * polynomials, going through a small scratch buffer instead of the half-size table.
+     * @param polynomials The full polynomials
+     * @param round_size \f$2^d\f$
+     */
+    void partially_evaluate_twice(auto& polynomials, size_t round_size, FF first_challenge, FF second_challenge)
+    {
+        static constexpr size_t TILE_SIZE = 64;
         auto pep_view = partially_evaluated_polynomials.get_all();
         auto poly_view = polynomials.get_all();
-        // after the first round, operate in place on partially_evaluated_polynomials
+        const bool use_active_ranges = active_ranges.size() == poly_view.size();
         parallel_for(poly_view.size(), [&](size_t j) {
-            for (size_t i = 0; i < round_size; i += 2) {
-                pep_view[j][i >> 1] = poly_view[j][i] + round_challenge * (poly_view[j][i + 1] - poly_view[j][i]);
+            const std::span<FF> pep{ pep_view[j] };
+            const std::span<const FF> poly{ poly_view[j] };
+            // The table is freshly allocated, so only the active rows need to be written
+            const ActiveRange range =
+                use_active_ranges ? active_ranges[j].folded().folded() : ActiveRange{ 0, round_size >> 2 };
+            std::array<FF, 2 * TILE_SIZE> scratch;
+            for (size_t start = range.start; start < range.end; start += TILE_SIZE) {
+                const size_t tile_size = std::min(TILE_SIZE, range.end - start);
+                const std::span<FF> half_folded{ scratch.data(), 2 * tile_size };
+                FF::batch_fold(half_folded, poly.subspan(start << 2, tile_size << 2), first_challenge);
+                FF::batch_fold(pep.subspan(start, tile_size), half_folded, second_challenge);
+            }
+            if (use_active_ranges) {
+                active_ranges[j] = range;
             }
         });
-    };
+    }
+
     /**
      * @brief Evaluate at the round challenge and prepare class for next round.
      * Specialization for array, see \ref bb::SumcheckProver<Flavor>::partially_evaluate "generic version".
@@ -283,13 +386,121 @@ template <typename Flavor> class SumcheckProver {
     template <typename PolynomialT, std::size_t N>
     void partially_evaluate(std::array<PolynomialT, N>& polynomials, size_t round_size, FF round_challenge)
     {
+        std::vector<ActiveRange> folded_ranges(N, ActiveRange{ 0, round_size >> 1 });
+        std::vector<size_t> stale_ends(N, 0);
+        fold_rows(polynomials, round_size, round_challenge, folded_ranges, stale_ends, /*in_place=*/false);
+    };
+
+  private:
+    /**
+     * @brief Fold the first \f$ 2^{d-i} \f$ rows of each column into the book-keeping table, see partially_evaluate
+     * @details Rather than giving each thread one column, which leaves threads idle when there are few columns or
+     * columns of very different active lengths, the output rows are split into contiguous chunks, one per thread, and
+     * each thread folds all of the columns over its chunk one tile of rows at a time.
+     *
+     * Output row \f$ \ell \f$ is computed from input rows \f$ 2\ell \f$ and \f$ 2\ell + 1 \f$. When folding in place,
+     * a chunk of rows must therefore not be written before the input rows it overlaps have been read. The first
+     * \f$ 1/8 \f$ of the rows are folded front to back, one column per thread, then the bands of rows
+     * \f$ [2^{-k-1}, 2^{-k}) \f$ are folded for \f$ k = 2, 1, 0 \f$, each in parallel: a band only reads rows of the
+     * next band, which have not been written yet.
+     * @param poly_view Columns to fold
+     * @param round_size Number of rows to fold, \f$ 2^{d-i} \f$
+     * @param folded_ranges For each column, the output rows to compute
+     * @param stale_ends For each column, rows in [folded_range.end, stale_end) are set to zero
+     * @param in_place Whether the columns are those of the book-keeping table
+     */
+    void fold_rows(const auto& poly_view,
+                   size_t round_size,
+                   const FF& round_challenge,
+                   const std::vector<ActiveRange>& folded_ranges,
+                   const std::vector<size_t>& stale_ends,
+                   bool in_place)
+    {
+        static constexpr size_t TILE_SIZE = 1 << 10;
+        static constexpr size_t MIN_FOLDS_PER_THREAD = 1 << 12;
+        static constexpr size_t NUM_BANDS = 3;
+
         auto pep_view = partially_evaluated_polynomials.get_all();
-        // after the first round, operate in place on partially_evaluated_polynomials
-        parallel_for(polynomials.size(), [&](size_t j) {
-            for (size_t i = 0; i < round_size; i += 2) {
-                pep_view[j][i >> 1] = polynomials[j][i] + round_challenge * (polynomials[j][i + 1] - polynomials[j][i]);
+        const size_t num_columns = folded_ranges.size();
+        const size_t num_rows = round_size >> 1;
+
+        // Fold rows [start, end) of column j, skipping the inactive rows
+        const auto fold_column = [&](size_t j, size_t start, size_t end) {
+            const std::span<FF> pep{ pep_view[j] };
+            const std::span<const FF> poly{ poly_view[j] };
+            const size_t fold_start = std::max(start, folded_ranges[j].start);
+            const size_t fold_end = std::min(end, folded_ranges[j].end);
+            if (fold_start < fold_end) {
+                FF::batch_fold(pep.subspan(fold_start, fold_end - fold_start),
+                               poly.subspan(fold_start << 1, (fold_end - fold_start) << 1),
+                               round_challenge);
             }
-        });
+            const size_t stale_end = std::min(end, stale_ends[j]);
+            for (size_t i = std::max(start, folded_ranges[j].end); i < stale_end; i++) {
+                pep[i] = 0;
+            }
+        };
+
+        // Fold rows [start, end) of every column, splitting the rows evenly between threads
+        const auto fold_band = [&](size_t start, size_t end) {
+            const size_t num_threads = calculate_num_threads((end - start) * num_columns, MIN_FOLDS_PER_THREAD);
+            parallel_for(num_threads, [&](size_t thread_idx) {
+                const size_t chunk_start = start + (thread_idx * (end - start)) / num_threads;
+                const size_t chunk_end = start + ((thread_idx + 1) * (end - start)) / num_threads;
+                for (size_t tile_start = chunk_start; tile_start < chunk_end; tile_start += TILE_SIZE) {
+                    const size_t tile_end = std::min(tile_start + TILE_SIZE, chunk_end);
+                    for (size_t j = 0; j < num_columns; j++) {
+                        fold_column(j, tile_start, tile_end);
+                    }
+                }
+            });
+        };
+
+        if (!in_place) {
+            fold_band(0, num_rows);
+            return;
+        }
+        const size_t prefix_end = num_rows >> NUM_BANDS;
+        if (prefix_end == 0) {
+            // Too few rows to split into bands
+            parallel_for(num_columns, [&](size_t j) { fold_column(j, 0, num_rows); });
+            return;
+        }
+        parallel_for(num_columns, [&](size_t j) { fold_column(j, 0, prefix_end); });
+        for (size_t band_start = prefix_end; band_start < num_rows; band_start <<= 1) {
+            fold_band(band_start, std::min(band_start << 1, num_rows));
+        }
+    }
+
+    /**
+     * @brief Read-only view of polynomials folded at a round challenge, each row being computed on access
+     * @details Exposes the same interface as the book-keeping table to \ref bb::SumcheckProverRound::compute_univariate
+     * "compute_univariate", see #fuse_first_fold.
+     */
+    class FoldedPolynomialsView {
+      public:
+        struct Column {
+            std::span<const FF> coefficients;
+            FF challenge;
+
+            FF operator[](size_t row_idx) const
+            {
+                const FF& lo = coefficients[row_idx << 1];
+                return lo + challenge * (coefficients[(row_idx << 1) + 1] - lo);
+            }
+        };
+
+        FoldedPolynomialsView(auto& polynomials, const FF& challenge)
+        {
+            for (auto& polynomial : polynomials.get_all()) {
+                columns.push_back({ std::span<const FF>{ polynomial }, challenge });
+            }
+        }
+
+        std::span<const Column> get_all() const { return columns; }
+
+      private:
+        std::vector<Column> columns;
     };
 };
 /*! \brief Implementation of the sumcheck Verifier for statements of the form \f$\sum_{\vec \ell \in \{0,1\}^d}
@@ -165,6 +165,134 @@ TEST_F(SumcheckTests, Prover)
     }
 }
 
+/**
+ * @brief Check that restricting the round computation to the active rows does not change the round univariates
+ * @details Rows [8, 24) have every selector zero and a constant grand product, so that every relation can be skipped
+ * there, except on row 23 where z_perm_shift differs from z_perm.
+ */
+TEST_F(SumcheckTests, RowSkipping)
+{
+    const size_t multivariate_d(5);
+    const size_t multivariate_n(1 << multivariate_d);
+
+    std::array<Polynomial<FF>, NUM_POLYNOMIALS> random_polynomials;
+    for (auto& poly : random_polynomials) {
+        poly = random_poly(multivariate_n);
+    }
+    auto full_polynomials = construct_ultra_full_polynomials(random_polynomials);
+    const FF z_perm_value = FF::random_element();
+    for (size_t i = 8; i < 24; i++) {
+        for (auto* selector : { &full_polynomials.q_arith,
+                                &full_polynomials.q_delta_range,
+                                &full_polynomials.q_elliptic,
+                                &full_polynomials.q_aux,
+                                &full_polynomials.q_lookup,
+                                &full_polynomials.lookup_read_counts }) {
+            (*selector)[i] = 0;
+        }
+        full_polynomials.z_perm[i] = z_perm_value;
+        full_polynomials.z_perm_shift[i] = i < 23 ? z_perm_value : FF::random_element();
+    }
+
+    RelationParameters<FF> relation_parameters{
+        .eta = FF::random_element(),
+        .eta_two = FF::random_element(),
+        .eta_three = FF::random_element(),
+        .beta = FF::random_element(),
+        .gamma = FF::random_element(),
+        .public_input_delta = FF::random_element(),
+    };
+    RelationSeparator alpha;
+    for (auto& alpha_i : alpha) {
+        alpha_i = FF::random_element();
+    }
+    std::vector<FF> gate_challenges(multivariate_d);
+    for (auto& gate_challenge : gate_challenges) {
+        gate_challenge = FF::random_element();
+    }
+    PowPolynomial<FF> pow_polynomial(gate_challenges);
+    pow_polynomial.compute_values();
+
+    auto sumcheck = SumcheckProver<Flavor>(multivariate_n, Flavor::Transcript::prover_init_empty());
+    sumcheck.round.compute_active_row_ranges(full_polynomials);
+    ASSERT_TRUE(sumcheck.round.active_row_ranges.has_value());
+    EXPECT_EQ(*sumcheck.round.active_row_ranges, (std::vector<ActiveRange>{ { 0, 8 }, { 22, 32 } }));
+
+    // Compare each round univariate against the one obtained by visiting every edge
+    auto check_round = [&](auto& polynomials) {
+        SumcheckProverRound<Flavor> dense_round(sumcheck.round.round_size);
+        auto expected = dense_round.compute_univariate(polynomials, relation_parameters, pow_polynomial, alpha);
+        auto result = sumcheck.round.compute_univariate(polynomials, relation_parameters, pow_polynomial, alpha);
+        EXPECT_EQ(result, expected);
+
+        FF round_challenge = FF::random_element();
+        sumcheck.partially_evaluate(polynomials, sumcheck.round.round_size, round_challenge);
+        pow_polynomial.partially_evaluate(round_challenge);
+        sumcheck.round.round_size >>= 1;
+        sumcheck.round.fold_active_row_ranges();
+    };
+    check_round(full_polynomials);
+    EXPECT_EQ(*sumcheck.round.active_row_ranges, (std::vector<ActiveRange>{ { 0, 4 }, { 10, 16 } }));
+    for (size_t round_idx = 1; round_idx < multivariate_d; round_idx++) {
+        check_round(sumcheck.partially_evaluated_polynomials);
+    }
+}
+
+/**
+ * @brief Check that the low-memory mode, which fuses the first partial evaluation into the second round, produces the
+ * same proof as the default mode
+ */
+TEST_F(SumcheckTests, LowMemoryProver)
+{
+    const size_t multivariate_d(5);
+    const size_t multivariate_n(1 << multivariate_d);
+
+    // Leave the upper half of a few columns empty, so that their active ranges are non-trivial
+    std::array<Polynomial<FF>, NUM_POLYNOMIALS> random_polynomials;
+    for (size_t idx = 0; idx < NUM_POLYNOMIALS; idx++) {
+        random_polynomials[idx] = random_poly(multivariate_n);
+        if (idx % 3 == 0) {
+            for (size_t i = multivariate_n / 2 - idx % 5; i < multivariate_n; i++) {
+                random_polynomials[idx][i] = 0;
+            }
+        }
+    }
+    auto full_polynomials = construct_ultra_full_polynomials(random_polynomials);
+
+    RelationParameters<FF> relation_parameters{
+        .beta = FF::random_element(),
+        .gamma = FF::random_element(),
+        .public_input_delta = FF::random_element(),
+    };
+
+    auto prove = [&](bool low_memory) {
+        auto transcript = Flavor::Transcript::prover_init_empty();
+        auto sumcheck = SumcheckProver<Flavor>(multivariate_n, transcript, low_memory);
+        EXPECT_EQ(sumcheck.partially_evaluated_polynomials.w_l.size(), multivariate_n >> (low_memory ? 2 : 1));
+
+        RelationSeparator alpha;
+        for (size_t idx = 0; idx < alpha.size(); idx++) {
+            alpha[idx] = transcript->template get_challenge<FF>("Sumcheck:alpha_" + std::to_string(idx));
+        }
+        std::vector<FF> gate_challenges(multivariate_d);
+        for (size_t idx = 0; idx < multivariate_d; idx++) {
+            gate_challenges[idx] =
+                transcript->template get_challenge<FF>("Sumcheck:gate_challenge_" + std::to_string(idx));
+        }
+        auto output = sumcheck.prove(full_polynomials, relation_parameters, alpha, gate_challenges);
+        return std::make_pair(output, transcript->proof_data);
+    };
+
+    auto [expected_output, expected_proof] = prove(/*low_memory=*/false);
+    auto [output, proof] = prove(/*low_memory=*/true);
+    EXPECT_EQ(output.challenge, expected_output.challenge);
+    for (auto [eval, expected_eval] :
+         zip_view(output.claimed_evaluations.get_all(), expected_output.claimed_evaluations.get_all())) {
+        EXPECT_EQ(eval, expected_eval);
+    }
+    EXPECT_EQ(proof, expected_proof);
+}
+
 // TODO(#225): make the inputs to this test more interesting, e.g. non-trivial permutations
 TEST_F(SumcheckTests, ProverAndVerifierSimple)
 {
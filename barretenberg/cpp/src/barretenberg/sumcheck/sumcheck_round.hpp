@@ -1,12 +1,15 @@
 #pragma once
 #include "barretenberg/common/thread.hpp"
 #include "barretenberg/flavor/flavor.hpp"
+#include "barretenberg/polynomials/active_range.hpp"
 #include "barretenberg/polynomials/pow.hpp"
 #include "barretenberg/relations/relation_parameters.hpp"
 #include "barretenberg/relations/relation_types.hpp"
 #include "barretenberg/relations/utils.hpp"
 #include "barretenberg/stdlib/primitives/bool/bool.hpp"
 
+#include <optional>
+
 namespace bb {
 
 /*! \brief Imlementation of the Sumcheck prover round.
@@ -23,6 +26,10 @@ polynomials to \f$ T^i(X_i)\f$
  - \ref bb::SumcheckProverRound::extend_and_batch_univariates "Extend and batch the subrelation contibutions"
  multiplying by the constants \f$c_i\f$ and the evaluations of \f$ ( (1−X_i) + X_i\cdot \beta_i ) \f$.
 
+ Edges on which every relation can be skipped contribute nothing to \f$ \tilde{S}^i \f$. When the \ref
+ active_row_ranges "active row ranges" have been computed, only the edges inside them are extended and accumulated, so
+ the cost of a round scales with the number of rows carrying gates rather than with the dyadic circuit size.
+
  Note: This class uses recursive function calls with template parameters. This is a common trick that is used to force
  the compiler to unroll loops. The idea is that a function that is only called once will always be inlined, and since
  template functions always create different functions, this is guaranteed.
@@ -60,8 +67,23 @@ template <typename Flavor> class SumcheckProverRound {
      */
     static constexpr size_t BATCHED_RELATION_PARTIAL_LENGTH = Flavor::BATCHED_RELATION_PARTIAL_LENGTH;
 
+    /**
+     * @brief Whether every relation of the Flavor has a skip hook that can be evaluated on a single row.
+     * @details Only then is an edge on which all of the hooks fire known to contribute nothing to the round univariate.
+     */
+    static constexpr bool ALL_RELATIONS_SKIPPABLE = Utils::template all_relations_skippable<typename Flavor::AllValues>;
+
     SumcheckTupleOfTuplesOfUnivariates univariate_accumulators;
 
+    /**
+     * @brief Sorted, disjoint ranges of rows of the current round's book-keeping table outside of which every relation
+     * can be skipped. Ranges start and end on even rows, i.e. they consist of whole edges.
+     * @details Computed from the full polynomials by \ref compute_active_row_ranges "compute_active_row_ranges" and
+     * folded along with the polynomials by \ref fold_active_row_ranges "fold_active_row_ranges". Left unset, every edge
+     * is treated as active.
+     */
+    std::optional<std::vector<ActiveRange>> active_row_ranges;
+
     // Prover constructor
     SumcheckProverRound(size_t initial_round_size)
         : round_size(initial_round_size)
@@ -138,13 +160,21 @@ template <typename Flavor> class SumcheckProverRound {
     {
         BB_OP_COUNT_TIME();
 
+        // Only the edges in the active row ranges are visited; by default, that is every edge of the hypercube.
+        const std::vector<ActiveRange> row_ranges =
+            active_row_ranges.value_or(std::vector<ActiveRange>{ { 0, round_size } });
+        size_t num_active_rows = 0;
+        for (const ActiveRange& range : row_ranges) {
+            num_active_rows += range.size();
+        }
+        const size_t num_active_edges = num_active_rows >> 1;
+
         // Determine number of threads for multithreading.
         // Note: Multithreading is "on" for every round but we reduce the number of threads from the max available based
         // on a specified minimum number of iterations per thread. This eventually leads to the use of a single thread.
-        // For now we use a power of 2 number of threads simply to ensure the round size is evenly divided.
+        // For now we use a power of 2 number of threads simply to ensure a dense round is evenly divided.
         size_t min_iterations_per_thread = 1 << 6; // min number of iterations for which we'll spin up a unique thread
-        size_t num_threads = bb::calculate_num_threads_pow2(round_size, min_iterations_per_thread);
-        size_t iterations_per_thread = round_size / num_threads; // actual iterations per thread
+        size_t num_threads = bb::calculate_num_threads_pow2(num_active_rows, min_iterations_per_thread);
 
         // Construct univariate accumulator containers; one per thread
         std::vector<SumcheckTupleOfTuplesOfUnivariates> thread_univariate_accumulators(num_threads);
@@ -157,22 +187,34 @@ template <typename Flavor> class SumcheckProverRound {
         extended_edges.resize(num_threads);
 
         // Accumulate the contribution from each sub-relation accross each edge of the hyper-cube
+        // The active edges are split evenly between the threads, regardless of how they are spread over the hypercube.
         parallel_for(num_threads, [&](size_t thread_idx) {
-            size_t start = thread_idx * iterations_per_thread;
-            size_t end = (thread_idx + 1) * iterations_per_thread;
-
-            for (size_t edge_idx = start; edge_idx < end; edge_idx += 2) {
-                extend_edges(extended_edges[thread_idx], polynomials, edge_idx);
-
-                // Compute the \f$ \ell \f$-th edge's univariate contribution,
-                // scale it by the corresponding \f$ pow_{\beta} \f$ contribution and add it to the accumulators for \f$
-                // \tilde{S}^i(X_i) \f$. If \f$ \ell \f$'s binary representation is given by \f$ (\ell_{i+1},\ldots,
-                // \ell_{d-1})\f$, the \f$ pow_{\beta}\f$-contribution is \f$\beta_{i+1}^{\ell_{i+1}} \cdot \ldots \cdot
-                // \beta_{d-1}^{\ell_{d-1}}\f$.
-                accumulate_relation_univariates(thread_univariate_accumulators[thread_idx],
-                                                extended_edges[thread_idx],
-                                                relation_parameters,
-                                                pow_polynomial[(edge_idx >> 1) * pow_polynomial.periodicity]);
+            const size_t start = (thread_idx * num_active_edges) / num_threads;
+            const size_t end = ((thread_idx + 1) * num_active_edges) / num_threads;
+
+            size_t range_offset = 0; // number of active edges in the ranges preceding the current one
+            for (const ActiveRange& range : row_ranges) {
+                const size_t range_edges = range.size() >> 1;
+                const size_t range_start = std::max(start, range_offset);
+                const size_t range_end = std::min(end, range_offset + range_edges);
+                for (size_t active_edge = range_start; active_edge < range_end; active_edge++) {
+                    const size_t edge_idx = range.start + ((active_edge - range_offset) << 1);
+                    extend_edges(extended_edges[thread_idx], polynomials, edge_idx);
+
+                    // Compute the \f$ \ell \f$-th edge's univariate contribution,
+                    // scale it by the corresponding \f$ pow_{\beta} \f$ contribution and add it to the accumulators for
+                    // \f$ \tilde{S}^i(X_i) \f$. If \f$ \ell \f$'s binary representation is given by
+                    // \f$ (\ell_{i+1},\ldots, \ell_{d-1})\f$, the \f$ pow_{\beta}\f$-contribution is
+                    // \f$\beta_{i+1}^{\ell_{i+1}} \cdot \ldots \cdot \beta_{d-1}^{\ell_{d-1}}\f$.
+                    accumulate_relation_univariates(thread_univariate_accumulators[thread_idx],
+                                                    extended_edges[thread_idx],
+                                                    relation_parameters,
+                                                    pow_polynomial[(edge_idx >> 1) * pow_polynomial.periodicity]);
+                }
+                range_offset += range_edges;
+                if (range_offset >= end) {
+                    break;
+                }
             }
         });
 
@@ -186,6 +228,76 @@ template <typename Flavor> class SumcheckProverRound {
             univariate_accumulators, alpha, pow_polynomial);
     }
 
+    /**
+     * @brief Record the ranges of edges on which at least one relation is active, see #active_row_ranges
+     * @details An edge is inactive if the skip hook of every relation fires on both of its rows. The hooks only test
+     * linear combinations of columns for zero, so they then also fire on every point of the extended edge, and on the
+     * rows obtained by folding two inactive rows with any challenge. This lets the ranges be computed once, on the full
+     * polynomials, and then folded from round to round. Does nothing for flavors with a relation that cannot be
+     * skipped.
+     */
+    template <typename ProverPolynomialsOrPartiallyEvaluatedMultivariates>
+    void compute_active_row_ranges(const ProverPolynomialsOrPartiallyEvaluatedMultivariates& polynomials)
+    {
+        BB_OP_COUNT_TIME();
+
+        active_row_ranges.reset();
+        if constexpr (ALL_RELATIONS_SKIPPABLE) {
+            const size_t num_edges = round_size >> 1;
+            const size_t num_threads = bb::calculate_num_threads(num_edges);
+            std::vector<std::vector<ActiveRange>> thread_row_ranges(num_threads);
+
+            parallel_for(num_threads, [&](size_t thread_idx) {
+                const size_t start = ((thread_idx * num_edges) / num_threads) << 1;
+                const size_t end = (((thread_idx + 1) * num_edges) / num_threads) << 1;
+                auto& ranges = thread_row_ranges[thread_idx];
+                typename Flavor::AllValues row;
+                const auto row_is_skippable = [&](size_t row_idx) {
+                    for (auto [value, polynomial] : zip_view(row.get_all(), polynomials.get_all())) {
+                        value = polynomial[row_idx];
+                    }
+                    return Utils::skip_all_relations(row);
+                };
+                for (size_t edge_idx = start; edge_idx < end; edge_idx += 2) {
+                    if (row_is_skippable(edge_idx) && row_is_skippable(edge_idx + 1)) {
+                        continue;
+                    }
+                    if (!ranges.empty() && ranges.back().end == edge_idx) {
+                        ranges.back().end += 2;
+                    } else {
+                        ranges.push_back({ edge_idx, edge_idx + 2 });
+                    }
+                }
+            });
+
+            std::vector<ActiveRange> ranges;
+            for (const auto& thread_ranges : thread_row_ranges) {
+                for (const ActiveRange& range : thread_ranges) {
+                    append_row_range(ranges, range);
+                }
+            }
+            active_row_ranges = std::move(ranges);
+        }
+    }
+
+    /**
+     * @brief Update #active_row_ranges after the book-keeping table has been folded at the round challenge
+     * @details Row \f$ \ell \f$ of the folded table is edge \f$ \ell \f$ of the previous round. Ranges are widened to
+     * whole edges, which may merge neighbouring ranges.
+     */
+    void fold_active_row_ranges()
+    {
+        if (!active_row_ranges) {
+            return;
+        }
+        std::vector<ActiveRange> ranges;
+        for (const ActiveRange& range : *active_row_ranges) {
+            const ActiveRange folded_range = range.folded();
+            append_row_range(ranges, { folded_range.start & ~size_t(1), (folded_range.end + 1) & ~size_t(1) });
+        }
+        active_row_ranges = std::move(ranges);
+    }
+
     /**
      * @brief Given a tuple of tuples of extended per-relation contributions,  \f$ (t_0, t_1, \ldots,
      * t_{\text{NUM_SUBRELATIONS}-1}) \f$ and a challenge \f$ \alpha \f$, scale them by the relation separator
@@ -264,6 +376,21 @@ template <typename Flavor> class SumcheckProverRound {
     }
 
   private:
+    /**
+     * @brief Append a range to a sorted list of row ranges, merging it with the last one if they touch or overlap
+     */
+    static void append_row_range(std::vector<ActiveRange>& ranges, const ActiveRange& range)
+    {
+        if (range.empty()) {
+            return;
+        }
+        if (!ranges.empty() && ranges.back().end >= range.start) {
+            ranges.back().end = std::max(ranges.back().end, range.end);
+        } else {
+            ranges.push_back(range);
+        }
+    }
+
     /**
      * @brief In Round \f$ i \f$, for a given point \f$ \vec \ell \in \{0,1\}^{d-1 - i}\f$, calculate the contribution
      * of each sub-relation to \f$ T^i(X_i) \f$.
@@ -80,3 +80,74 @@ TEST_F(TranslatorTests, Basic)
     bool verified = verifier.verify_proof(proof);
     EXPECT_TRUE(verified);
 }
+
+/**
+ * @brief Check that a proving key constructed from the op queue alone, before the challenges are known, yields the
+ * same precomputed polynomials as one constructed from the circuit and a valid proof
+ *
+ */
+TEST_F(TranslatorTests, PrecomputedProvingKey)
+{
+    using G1 = g1::affine_element;
+    using Fr = fr;
+    using Fq = fq;
+
+    auto P1 = G1::random_element();
+    auto P2 = G1::random_element();
+    auto z = Fr::random_element();
+
+    auto op_queue = std::make_shared<bb::ECCOpQueue>();
+    op_queue->append_nonzero_ops();
+
+    for (size_t i = 0; i < 1500; i++) {
+        op_queue->add_accumulate(P1);
+        op_queue->mul_accumulate(P2, z);
+    }
+
+    // Construct the key from the op queue only
+    auto precomputed_key = std::make_shared<TranslatorFlavor::ProvingKey>(
+        TranslatorFlavor::compute_mini_circuit_dyadic_size(*op_queue));
+
+    auto prover_transcript = std::make_shared<Transcript>();
+    prover_transcript->send_to_verifier("init", Fq::random_element());
+    prover_transcript->export_proof();
+    Fq translation_batching_challenge = prover_transcript->template get_challenge<Fq>("Translation:batching_challenge");
+    Fq translation_evaluation_challenge = Fq::random_element();
+
+    auto circuit_builder = CircuitBuilder(translation_batching_challenge, translation_evaluation_challenge, op_queue);
+
+    TranslatorFlavor::ProvingKey circuit_key{ circuit_builder };
+    ASSERT_EQ(precomputed_key->circuit_size, circuit_key.circuit_size);
+    for (auto [expected, precomputed] :
+         zip_view(circuit_key.polynomials.get_precomputed(), precomputed_key->polynomials.get_precomputed())) {
+        EXPECT_EQ(expected, precomputed);
+    }
+
+    TranslatorProver prover{ circuit_builder, prover_transcript, precomputed_key };
+    auto proof = prover.construct_proof();
+
+    auto verifier_transcript = std::make_shared<Transcript>(prover_transcript->proof_data);
+    verifier_transcript->template receive_from_prover<Fq>("init");
+    TranslatorVerifier verifier(prover.key, verifier_transcript);
+    EXPECT_TRUE(verifier.verify_proof(proof));
+}
+
+/**
+ * @brief Check that a precomputed proving key of the wrong size is rejected rather than silently used
+ *
+ */
+TEST_F(TranslatorTests, PrecomputedProvingKeyOfWrongSize)
+{
+    using Fq = fq;
+
+    auto op_queue = std::make_shared<bb::ECCOpQueue>();
+    op_queue->append_nonzero_ops();
+    op_queue->add_accumulate(g1::affine_element::random_element());
+
+    auto wrong_size_key = std::make_shared<TranslatorFlavor::ProvingKey>(
+        2 * TranslatorFlavor::compute_mini_circuit_dyadic_size(*op_queue));
+
+    auto circuit_builder = CircuitBuilder(Fq::random_element(), Fq::random_element(), op_queue);
+    auto prover_transcript = std::make_shared<Transcript>();
+    EXPECT_ANY_THROW(TranslatorProver(circuit_builder, prover_transcript, wrong_size_key));
+}
@@ -438,6 +438,15 @@ class TranslatorCircuitBuilder : public CircuitBuilderBase<bb::fr> {
                 uint256_t(get_variable(wires[WireIds::ACCUMULATORS_BINARY_LIMBS_2][RESULT_ROW])) * SHIFT_2 +
                 uint256_t(get_variable(wires[WireIds::ACCUMULATORS_BINARY_LIMBS_3][RESULT_ROW])) * SHIFT_3);
     }
+    /**
+     * @brief The number of gates (including the zero row) in a circuit fed with the given queue, which does not depend
+     * on the challenges
+     */
+    static size_t compute_num_gates(const ECCOpQueue& ecc_op_queue)
+    {
+        return 1 + 2 * ecc_op_queue.get_raw_ops().size();
+    }
+
     /**
      * @brief Generate all the gates required to prove the correctness of batched evalution of polynomials representing
      * commitments to ECCOpQueue
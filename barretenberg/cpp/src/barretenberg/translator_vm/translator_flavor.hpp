@@ -131,8 +131,11 @@ class TranslatorFlavor {
 
         inline void compute_lagrange_polynomials(const CircuitBuilder& builder)
         {
-            const size_t mini_circuit_dyadic_size = compute_mini_circuit_dyadic_size(builder);
+            compute_lagrange_polynomials(compute_mini_circuit_dyadic_size(builder));
+        }
 
+        inline void compute_lagrange_polynomials(const size_t mini_circuit_dyadic_size)
+        {
             for (size_t i = 1; i < mini_circuit_dyadic_size - 1; i += 2) {
                 this->lagrange_odd_in_minicircuit[i] = 1;
                 this->lagrange_even_in_minicircuit[i + 1] = 1;
@@ -739,6 +742,18 @@ class TranslatorFlavor {
         return std::max(builder.num_gates, MINIMUM_MINI_CIRCUIT_SIZE);
     }
 
+    /**
+     * @brief The size of the mini circuit a builder fed with the given op queue will have, known before the challenges
+     * the builder needs are
+     */
+    static inline size_t compute_mini_circuit_dyadic_size(const ECCOpQueue& op_queue)
+    {
+        const size_t total_num_gates =
+            std::max(CircuitBuilder::compute_num_gates(op_queue), MINIMUM_MINI_CIRCUIT_SIZE);
+        const size_t mini_circuit_dyadic_size = 1UL << numeric::get_msb(total_num_gates);
+        return mini_circuit_dyadic_size == total_num_gates ? mini_circuit_dyadic_size : mini_circuit_dyadic_size << 1;
+    }
+
     static inline size_t compute_dyadic_circuit_size(const CircuitBuilder& builder)
     {
         const size_t total_num_gates = compute_total_num_gates(builder);
@@ -823,9 +838,18 @@ class TranslatorFlavor {
 
         ProvingKey() = default;
         ProvingKey(const CircuitBuilder& builder)
-            : Base(compute_dyadic_circuit_size(builder), 0)
-            , batching_challenge_v(builder.batching_challenge_v)
-            , evaluation_input_x(builder.evaluation_input_x)
+            : ProvingKey(compute_mini_circuit_dyadic_size(builder))
+        {
+            batching_challenge_v = builder.batching_challenge_v;
+            evaluation_input_x = builder.evaluation_input_x;
+        }
+
+        /**
+         * @brief Construct a proving key holding only the precomputed polynomials, which depend on nothing but the size
+         * of the mini circuit; the challenges are set once the circuit has been built (see TranslatorProver)
+         */
+        ProvingKey(const size_t mini_circuit_dyadic_size)
+            : Base(mini_circuit_dyadic_size * CONCATENATION_GROUP_SIZE, 0)
             , polynomials(this->circuit_size)
         {
             // First and last lagrange polynomials (in the full circuit size)
@@ -834,7 +858,7 @@ class TranslatorFlavor {
 
             // Compute polynomials with odd and even indices set to 1 up to the minicircuit margin + lagrange
             // polynomials at second and second to last indices in the minicircuit
-            polynomials.compute_lagrange_polynomials(builder);
+            polynomials.compute_lagrange_polynomials(mini_circuit_dyadic_size);
 
             // Compute the numerator for the permutation argument with several repetitions of steps bridging 0 and
             // maximum range constraint compute_extra_range_constraint_numerator();
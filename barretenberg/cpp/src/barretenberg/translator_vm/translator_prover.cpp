@@ -2,6 +2,7 @@
 #include "barretenberg/commitment_schemes/claim.hpp"
 #include "barretenberg/commitment_schemes/commitment_key.hpp"
 #include "barretenberg/commitment_schemes/zeromorph/zeromorph.hpp"
+#include "barretenberg/common/throw_or_abort.hpp"
 #include "barretenberg/honk/proof_system/permutation_library.hpp"
 #include "barretenberg/plonk_honk_shared/library/grand_product_library.hpp"
 #include "barretenberg/sumcheck/sumcheck.hpp"
@@ -21,6 +22,35 @@ TranslatorProver::TranslatorProver(CircuitBuilder& circuit_builder, const std::s
     compute_commitment_key(key->circuit_size);
 }
 
+/**
+ * @brief Construct the prover from a proving key whose precomputed polynomials were computed in advance (e.g. while
+ * ECCVM was still producing the challenges the circuit depends on)
+ *
+ * @param precomputed_key A key constructed from the mini circuit size of the builder; only its witness polynomials and
+ * challenges are populated herein
+ * @param precomputed_commitment_key Optional commitment key for the circuit size of the key (otherwise computed herein)
+ */
+TranslatorProver::TranslatorProver(CircuitBuilder& circuit_builder,
+                                   const std::shared_ptr<Transcript>& transcript,
+                                   const std::shared_ptr<ProvingKey>& precomputed_key,
+                                   const std::shared_ptr<CommitmentKey>& precomputed_commitment_key)
+    : dyadic_circuit_size(Flavor::compute_dyadic_circuit_size(circuit_builder))
+    , mini_circuit_dyadic_size(Flavor::compute_mini_circuit_dyadic_size(circuit_builder))
+    , transcript(transcript)
+    , key(precomputed_key)
+    , commitment_key(precomputed_commitment_key)
+{
+    BB_OP_COUNT_TIME();
+    if (key->circuit_size != dyadic_circuit_size) {
+        throw_or_abort("TranslatorProver: the precomputed proving key does not match the size of the circuit");
+    }
+
+    key->batching_challenge_v = circuit_builder.batching_challenge_v;
+    key->evaluation_input_x = circuit_builder.evaluation_input_x;
+    compute_witness(circuit_builder);
+    compute_commitment_key(key->circuit_size);
+}
+
 /**
  * @brief Compute witness polynomials
  *
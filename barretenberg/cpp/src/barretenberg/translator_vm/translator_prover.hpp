@@ -29,6 +29,11 @@ class TranslatorProver {
 
     explicit TranslatorProver(CircuitBuilder& circuit_builder, const std::shared_ptr<Transcript>& transcript);
 
+    TranslatorProver(CircuitBuilder& circuit_builder,
+                     const std::shared_ptr<Transcript>& transcript,
+                     const std::shared_ptr<ProvingKey>& precomputed_key,
+                     const std::shared_ptr<CommitmentKey>& precomputed_commitment_key = nullptr);
+
     void compute_witness(CircuitBuilder& circuit_builder);
     std::shared_ptr<CommitmentKey> compute_commitment_key(size_t circuit_size);
 
@@ -29,7 +29,7 @@ template <IsUltraFlavor Flavor> void DeciderProver_<Flavor>::execute_relation_ch
 {
     using Sumcheck = SumcheckProver<Flavor>;
     auto instance_size = accumulator->proving_key.circuit_size;
-    auto sumcheck = Sumcheck(instance_size, transcript);
+    auto sumcheck = Sumcheck(instance_size, transcript, low_memory_sumcheck);
     sumcheck_output = sumcheck.prove(accumulator);
 }
 
@@ -48,6 +48,9 @@ template <IsUltraFlavor Flavor> class DeciderProver_ {
 
     std::shared_ptr<CommitmentKey> commitment_key;
 
+    // Run sumcheck in low-memory mode, see SumcheckProver::fuse_first_fold
+    bool low_memory_sumcheck = false;
+
   private:
     HonkProof proof;
 };
@@ -69,9 +69,13 @@ template <IsUltraFlavor Flavor> void OinkProver<Flavor>::execute_wire_commitment
     // We only commit to the fourth wire polynomial after adding memory recordss
     {
         BB_OP_COUNT_TIME_NAME("COMMIT::wires");
-        witness_commitments.w_l = commitment_key->commit(proving_key.polynomials.w_l);
-        witness_commitments.w_r = commitment_key->commit(proving_key.polynomials.w_r);
-        witness_commitments.w_o = commitment_key->commit(proving_key.polynomials.w_o);
+        std::array<std::span<const FF>, 3> wires{ proving_key.polynomials.w_l,
+                                                  proving_key.polynomials.w_r,
+                                                  proving_key.polynomials.w_o };
+        auto commitments = commitment_key->commit_batch(wires, proving_key.active_block_ranges);
+        witness_commitments.w_l = commitments[0];
+        witness_commitments.w_r = commitments[1];
+        witness_commitments.w_o = commitments[2];
     }
 
     auto wire_comms = witness_commitments.get_wires();
@@ -125,12 +129,17 @@ template <IsUltraFlavor Flavor> void OinkProver<Flavor>::execute_sorted_list_acc
     // Commit to lookup argument polynomials and the finalized (i.e. with memory records) fourth wire polynomial
     {
         BB_OP_COUNT_TIME_NAME("COMMIT::lookup_counts_tags");
-        witness_commitments.lookup_read_counts = commitment_key->commit(proving_key.polynomials.lookup_read_counts);
-        witness_commitments.lookup_read_tags = commitment_key->commit(proving_key.polynomials.lookup_read_tags);
+        std::array<std::span<const FF>, 2> polynomials{ proving_key.polynomials.lookup_read_counts,
+                                                        proving_key.polynomials.lookup_read_tags };
+        auto commitments = commitment_key->commit_batch(polynomials);
+        witness_commitments.lookup_read_counts = commitments[0];
+        witness_commitments.lookup_read_tags = commitments[1];
     }
     {
+        // The lookup counts and tags live on the table rows, whereas the fourth wire only lives on the gate blocks
         BB_OP_COUNT_TIME_NAME("COMMIT::wires");
-        witness_commitments.w_4 = commitment_key->commit(proving_key.polynomials.w_4);
+        witness_commitments.w_4 =
+            commitment_key->commit_structured(proving_key.polynomials.w_4, proving_key.active_block_ranges);
     }
 
     transcript->send_to_verifier(domain_separator + commitment_labels.lookup_read_counts,
@@ -57,6 +57,7 @@ template <IsUltraFlavor Flavor> HonkProof UltraProver_<Flavor>::construct_proof(
     generate_gate_challenges();
 
     DeciderProver_<Flavor> decider_prover(instance, transcript);
+    decider_prover.low_memory_sumcheck = low_memory_sumcheck;
     return decider_prover.construct_proof();
 }
 
@@ -38,6 +38,9 @@ template <IsUltraFlavor Flavor_> class UltraProver_ {
 
     std::shared_ptr<CommitmentKey> commitment_key;
 
+    // Run sumcheck in its low-memory mode (see SumcheckProver), trading some time for a smaller book-keeping table
+    bool low_memory_sumcheck = false;
+
     explicit UltraProver_(const std::shared_ptr<Instance>&,
                           const std::shared_ptr<Transcript>& transcript = std::make_shared<Transcript>());
 
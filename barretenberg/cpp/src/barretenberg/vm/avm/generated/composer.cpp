@@ -15,11 +15,17 @@ void AvmComposer::compute_witness(CircuitConstructor& circuit)
         return;
     }
 
+    // The proving key is constructed with zeroed polynomials. Release them before transposing the trace and move the
+    // transposed columns in afterwards, so that only one set of columns (plus the trace) is resident at any time.
+    for (auto& key_poly : proving_key->get_all()) {
+        key_poly = Flavor::Polynomial();
+    }
+
     auto polynomials = circuit.compute_polynomials();
 
     for (auto [key_poly, prover_poly] : zip_view(proving_key->get_all(), polynomials.get_unshifted())) {
         ASSERT(flavor_get_label(*proving_key, key_poly) == flavor_get_label(polynomials, prover_poly));
-        key_poly = prover_poly;
+        key_poly = std::move(prover_poly);
     }
 
     computed_witness = true;
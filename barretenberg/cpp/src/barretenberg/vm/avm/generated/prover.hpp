@@ -57,6 +57,9 @@ class AvmProver {
 
     std::shared_ptr<PCSCommitmentKey> commitment_key;
 
+    // Run sumcheck in low-memory mode, see SumcheckProver::fuse_first_fold
+    bool low_memory_sumcheck = false;
+
   private:
     HonkProof proof;
 };
@@ -31,6 +31,7 @@ using namespace bb;
 
 // Set in BB's main.cpp.
 std::filesystem::path avm_dump_trace_path;
+bool avm_low_memory_sumcheck = false;
 
 namespace bb::avm_trace {
 namespace {
@@ -134,8 +135,12 @@ std::tuple<AvmFlavor::VerificationKey, HonkProof> Execution::prove(std::vector<u
 
     auto composer = AVM_TRACK_TIME_V("prove/create_composer", AvmComposer());
     auto prover = AVM_TRACK_TIME_V("prove/create_prover", composer.create_prover(circuit_builder));
+    prover.low_memory_sumcheck = avm_low_memory_sumcheck;
     auto verifier = AVM_TRACK_TIME_V("prove/create_verifier", composer.create_verifier(circuit_builder));
 
+    // From here on only the polynomials in the proving key are needed, so release the row-major trace before proving.
+    std::vector<Row>().swap(circuit_builder.rows);
+
     vinfo("------- PROVING EXECUTION -------");
     // Proof structure: public_inputs | calldata_size | calldata | returndata_size | returndata | raw proof
     HonkProof proof(public_inputs_vec);